@@ -0,0 +1,212 @@
+/**
+ * @file self_bench.c
+ * @brief Self-benchmark suite for the harness's own primitives
+ *
+ * Measures the cost of the primitives certifiable-bench itself relies
+ * on — the portable timer read, cb_verify_ctx_update() hashing,
+ * cb_sort_u64() and cb_histogram_build() — using the project's own
+ * runner, so a port to a new board can characterise the harness before
+ * trusting production numbers, and harness performance regressions are
+ * caught the same way model regressions are.
+ *
+ * Each primitive is wrapped as a cb_inference_fn and run through
+ * cb_run_benchmark(); one JSON report per primitive is written through
+ * cb_write_json() for comparison against the checked-in baselines
+ * under benchmarks/baselines/.
+ *
+ *   cb-bench-self [output-dir]      (default: current directory)
+ *
+ * @traceability SRS-003-RUNNER §4.13
+ *
+ * Copyright © 2026 The Murray Family Innovation Trust. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "cb_metrics.h"
+#include "cb_platform.h"
+#include "cb_report.h"
+#include "cb_runner.h"
+#include "cb_timer.h"
+#include "cb_verify.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Workloads (statically allocated)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#define BENCH_SAMPLES      4096     /* Runner sample buffer capacity */
+#define HASH_BLOCK_SIZE    65536    /* One cb_verify_ctx_update() call */
+#define SORT_COUNT         4096     /* Elements per cb_sort_u64() call */
+#define HISTOGRAM_BINS     64
+
+static uint64_t g_sample_buffer[BENCH_SAMPLES];
+
+static uint8_t g_hash_block[HASH_BLOCK_SIZE];
+static cb_verify_ctx_t g_hash_ctx;
+
+static uint64_t g_sort_input[SORT_COUNT];    /* Pristine, unsorted */
+static uint64_t g_sort_scratch[SORT_COUNT];
+
+static uint64_t g_hist_samples[SORT_COUNT];
+static cb_histogram_bin_t g_hist_bins[HISTOGRAM_BINS];
+static cb_histogram_t g_histogram;
+
+/* Sink defeating dead-code elimination of the timer read */
+static volatile uint64_t g_sink;
+
+/**
+ * @brief Deterministic pseudo-random fill (xorshift64)
+ */
+static void fill_workloads(void)
+{
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    uint32_t i;
+
+    for (i = 0; i < HASH_BLOCK_SIZE; i++) {
+        g_hash_block[i] = (uint8_t)(i * 131U + 17U);
+    }
+    for (i = 0; i < SORT_COUNT; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        g_sort_input[i] = state;
+        /* Latency-shaped values so the histogram pass exercises all bins */
+        g_hist_samples[i] = 1000U + (state % 9000U);
+    }
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Primitives as Inference Functions
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief One full portable timer read
+ */
+static cb_result_code_t bench_timer_read(void *ctx, const void *input,
+                                         void *output)
+{
+    (void)ctx;
+    (void)input;
+    (void)output;
+    g_sink = cb_timer_now_ns();
+    return CB_OK;
+}
+
+/**
+ * @brief Hash one 64 KiB block through the verification context
+ */
+static cb_result_code_t bench_hash_update(void *ctx, const void *input,
+                                          void *output)
+{
+    (void)ctx;
+    (void)input;
+    (void)output;
+    return cb_verify_ctx_update(&g_hash_ctx, g_hash_block, HASH_BLOCK_SIZE);
+}
+
+/**
+ * @brief Sort 4096 pseudo-random u64 values
+ *
+ * The pristine input is copied into scratch each call — the copy is
+ * part of the measured cost, as it is in cb_detect_outliers().
+ */
+static cb_result_code_t bench_sort(void *ctx, const void *input, void *output)
+{
+    (void)ctx;
+    (void)input;
+    (void)output;
+    memcpy(g_sort_scratch, g_sort_input, sizeof(g_sort_scratch));
+    cb_sort_u64(g_sort_scratch, SORT_COUNT);
+    return CB_OK;
+}
+
+/**
+ * @brief Bin 4096 samples into a 64-bin linear histogram
+ */
+static cb_result_code_t bench_histogram(void *ctx, const void *input,
+                                        void *output)
+{
+    (void)ctx;
+    (void)input;
+    (void)output;
+    return cb_histogram_build(g_hist_samples, SORT_COUNT, &g_histogram);
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Driver
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Run one primitive and write its JSON report
+ */
+static int run_primitive(const char *name, cb_inference_fn fn,
+                         const char *output_dir)
+{
+    cb_config_t config;
+    cb_result_t result;
+    cb_result_code_t rc;
+    char path[512];
+
+    cb_config_init(&config);
+    config.warmup_iterations = 200;
+    config.measure_iterations = BENCH_SAMPLES;
+    config.verify_outputs = false;
+    config.monitor_environment = false;
+
+    rc = cb_run_benchmark(&config, fn, NULL, NULL, 0, NULL, 0,
+                          g_sample_buffer, BENCH_SAMPLES, &result);
+    if (rc != CB_OK) {
+        fprintf(stderr, "error: %s failed (code %d)\n", name, rc);
+        return 1;
+    }
+
+    snprintf(path, sizeof(path), "%s/self_%s.json", output_dir, name);
+    rc = cb_write_json(&result, path);
+    if (rc != CB_OK) {
+        fprintf(stderr, "error: cannot write %s (code %d)\n", path, rc);
+        return 1;
+    }
+
+    printf("  %-10s  mean %8lu ns   p99 %8lu ns   %10lu calls/sec\n",
+           name,
+           (unsigned long)result.latency.mean_ns,
+           (unsigned long)result.latency.p99_ns,
+           (unsigned long)result.throughput.inferences_per_sec);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *output_dir = (argc > 1) ? argv[1] : ".";
+    int failures = 0;
+
+    printf("═══════════════════════════════════════════════════════════════════\n");
+    printf("  certifiable-bench self-benchmark suite\n");
+    printf("═══════════════════════════════════════════════════════════════════\n\n");
+
+    cb_timer_init(CB_TIMER_AUTO);
+    printf("Timer:     %s (resolution: %lu ns)\n",
+           cb_timer_name(), (unsigned long)cb_timer_resolution_ns());
+    printf("Platform:  %s\n", cb_platform_name());
+    printf("Output:    %s/self_*.json\n\n", output_dir);
+
+    fill_workloads();
+    if (cb_verify_ctx_init(&g_hash_ctx) != CB_OK ||
+        cb_histogram_init(&g_histogram, g_hist_bins, HISTOGRAM_BINS,
+                          0, 10000) != CB_OK) {
+        fprintf(stderr, "error: workload initialisation failed\n");
+        return 1;
+    }
+
+    failures += run_primitive("timer", bench_timer_read, output_dir);
+    failures += run_primitive("hash", bench_hash_update, output_dir);
+    failures += run_primitive("sort", bench_sort, output_dir);
+    failures += run_primitive("histogram", bench_histogram, output_dir);
+
+    printf("\nCompare against benchmarks/baselines/<platform>/ for the\n");
+    printf("expected order of magnitude on a quiet host.\n");
+
+    return (failures > 0) ? 1 : 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file cb_data.h
+ * @brief Zero-copy data loading API
+ *
+ * Memory-maps model bundles and test-data corpora read-only and hands
+ * out bounds-checked slice views, so multi-gigabyte inputs are never
+ * copied through user-space buffers. No dynamic allocation — the
+ * mapping is backed directly by the kernel page cache.
+ *
+ * @traceability SRS-007-DATA, CB-STRUCT-001 §9
+ *
+ * Copyright © 2026 The Murray Family Innovation Trust. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef CB_DATA_H
+#define CB_DATA_H
+
+#include "cb_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Mapping Lifecycle (SRS-007-DATA §4.1)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Map a file read-only into the address space
+ *
+ * Opens path, maps it with PROT_READ, and closes the descriptor — the
+ * mapping keeps the file alive. With prefault, pages are populated at
+ * map time (MAP_POPULATE plus an MADV_WILLNEED hint where available)
+ * so no major faults land inside the measured region; without it,
+ * pages fault in lazily, which is the right choice for corpora larger
+ * than memory.
+ *
+ * @param map      Mapping descriptor to fill
+ * @param path     Path to the file to map
+ * @param prefault true to populate pages at map time
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if map or path is NULL
+ * @return CB_ERR_DATA_LOAD if the file cannot be opened, is empty, or
+ *         the mapping fails
+ *
+ * @satisfies DATA-F-001 through DATA-F-004
+ * @traceability SRS-007-DATA §4.1
+ */
+cb_result_code_t cb_data_map(cb_data_map_t *map,
+                             const char *path,
+                             bool prefault);
+
+/**
+ * @brief Release a mapping
+ *
+ * Unmaps the file and resets the descriptor. Any slice pointers
+ * obtained from the mapping are invalid afterwards.
+ *
+ * @param map Mapping to release
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if map is NULL
+ * @return CB_ERR_INVALID_CONFIG if the mapping is not live
+ *
+ * @satisfies DATA-F-005
+ * @traceability SRS-007-DATA §4.1
+ */
+cb_result_code_t cb_data_unmap(cb_data_map_t *map);
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Content Verification (SRS-007-DATA §4.2)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Verify the mapped content against an expected hash
+ *
+ * Streams the whole mapping through SHA-256 and compares against
+ * expected — typically the content hash stored next to a corpus when
+ * it was generated. Run once at map time; a benchmark then knows it
+ * measured the bytes it thinks it measured.
+ *
+ * @param map      Live mapping to verify
+ * @param expected Expected content hash
+ * @return CB_OK if the content matches
+ * @return CB_ERR_NULL_PTR if map or expected is NULL
+ * @return CB_ERR_INVALID_CONFIG if the mapping is not live
+ * @return CB_ERR_VERIFICATION if the content does not match
+ *
+ * @satisfies DATA-F-010, DATA-F-011
+ * @traceability SRS-007-DATA §4.2, CB-MATH-001 §8.1
+ */
+cb_result_code_t cb_data_verify(const cb_data_map_t *map,
+                                const cb_hash_t *expected);
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Slice Views (SRS-007-DATA §4.3)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Number of fixed-size records the mapping holds
+ *
+ * @param map         Live mapping
+ * @param record_size Record size in bytes
+ * @return size / record_size, or 0 if map is not live or record_size
+ *         is 0
+ *
+ * @satisfies DATA-F-020
+ * @traceability SRS-007-DATA §4.3
+ */
+uint64_t cb_data_num_records(const cb_data_map_t *map,
+                             uint32_t record_size);
+
+/**
+ * @brief Bounds-checked view of one fixed-size record
+ *
+ * Returns a pointer into the mapping at index × record_size — no
+ * copying. The view is valid until cb_data_unmap() and must be
+ * treated as read-only; writing through it faults.
+ *
+ * @param map         Live mapping
+ * @param index       Record index
+ * @param record_size Record size in bytes (must be > 0)
+ * @param slice       Receives the record pointer
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if map or slice is NULL
+ * @return CB_ERR_INVALID_CONFIG if the mapping is not live,
+ *         record_size is 0, or the record extends past the end
+ *
+ * @satisfies DATA-F-021, DATA-F-022
+ * @traceability SRS-007-DATA §4.3
+ */
+cb_result_code_t cb_data_slice(const cb_data_map_t *map,
+                               uint64_t index,
+                               uint32_t record_size,
+                               const void **slice);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_DATA_H */
@@ -62,6 +62,60 @@ uint64_t cb_percentile(const uint64_t *sorted_samples,
                        uint32_t count,
                        uint32_t percentile);
 
+/**
+ * @brief Compute percentile by in-place selection (no full sort)
+ *
+ * Deterministic quickselect with a median-of-three pivot places only the
+ * order statistics the interpolation needs, then applies the same
+ * integer interpolation as cb_percentile(). Expected O(n) versus the
+ * O(n log n) full sort — the preferred path when only one or two
+ * percentiles are wanted from a large run. Partition depth is bounded
+ * with a heapsort fallback, so the worst case remains O(n log n).
+ *
+ * The sample buffer is partially reordered in place; it is NOT left
+ * fully sorted. Results are bit-identical to sorting with cb_sort_u64()
+ * and calling cb_percentile().
+ *
+ * @param samples    Raw (unsorted) array of measurements; reordered in place
+ * @param count      Number of samples (must be > 0)
+ * @param percentile Percentile to compute (0-100)
+ * @return Percentile value, or 0 if inputs invalid
+ *
+ * @satisfies METRICS-F-030 through METRICS-F-036
+ * @traceability SRS-002-METRICS §4.3, CB-MATH-001 §6.4
+ */
+uint64_t cb_percentile_select(uint64_t *samples,
+                              uint32_t count,
+                              uint32_t percentile);
+
+/**
+ * @brief Extract p50, p95 and p99 in one shared selection pass
+ *
+ * Multi-quantile variant of cb_percentile_select(): all three targets
+ * share each partitioning pass, so the cost is close to a single
+ * selection rather than three. Intended for live monitoring wrappers
+ * that poll percentiles periodically and cannot afford a full sort.
+ *
+ * The sample buffer is partially reordered in place. Results are
+ * bit-identical to the sorted-array path used by cb_compute_stats().
+ *
+ * @param samples Raw (unsorted) array of measurements; reordered in place
+ * @param count   Number of samples (0 yields all-zero outputs)
+ * @param p50     Output: median
+ * @param p95     Output: 95th percentile
+ * @param p99     Output: 99th percentile
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if any pointer is NULL
+ *
+ * @satisfies METRICS-F-030 through METRICS-F-036
+ * @traceability SRS-002-METRICS §4.3, CB-MATH-001 §6.4
+ */
+cb_result_code_t cb_percentile_select3(uint64_t *samples,
+                                       uint32_t count,
+                                       uint64_t *p50,
+                                       uint64_t *p95,
+                                       uint64_t *p99);
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Basic Statistics (CB-MATH-001 §6.1, §6.2)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -95,6 +149,93 @@ cb_result_code_t cb_compute_stats(uint64_t *samples,
                                   cb_latency_stats_t *stats,
                                   cb_fault_flags_t *faults);
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Streaming Statistics (CB-MATH-001 §6.7)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Initialise streaming statistics accumulator
+ *
+ * Prepares a constant-memory accumulator for runs whose sample count
+ * exceeds CB_MAX_SAMPLES. No buffers are required — state lives
+ * entirely inside the structure.
+ *
+ * @param stream Accumulator to initialise
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if stream is NULL
+ *
+ * @traceability SRS-002-METRICS §4.6, CB-MATH-001 §6.7
+ */
+cb_result_code_t cb_stats_stream_init(cb_stats_stream_t *stream);
+
+/**
+ * @brief Feed one sample into the streaming accumulator
+ *
+ * Updates min/max, integer Welford mean/variance, and the P²-style
+ * quantile estimators in O(1) time and constant memory. Sum overflow
+ * sets the overflow fault; accumulation continues using the Welford
+ * mean as fallback (matching cb_compute_stats() behaviour).
+ *
+ * @param stream    Initialised accumulator
+ * @param sample_ns Latency sample in nanoseconds
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if stream is NULL
+ *
+ * @traceability SRS-002-METRICS §4.6, CB-MATH-001 §6.7
+ */
+cb_result_code_t cb_stats_stream_update(cb_stats_stream_t *stream,
+                                        uint64_t sample_ns);
+
+/**
+ * @brief Finalise streaming statistics into a latency stats structure
+ *
+ * Percentiles (median, p95, p99) are P² estimates — exact while the
+ * estimators are still seeding (count ≤ 5), approximate thereafter.
+ * outlier_count is always 0 in streaming mode: outlier detection
+ * requires the retained sample array (use cb_detect_outliers()).
+ *
+ * @param stream Accumulator (not modified)
+ * @param stats  Output statistics structure
+ * @param faults Fault flags (overflow, div_zero set on error)
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if any pointer is NULL
+ * @return CB_ERR_OVERFLOW if no samples were accumulated
+ *
+ * @traceability SRS-002-METRICS §4.6, CB-MATH-001 §6.7
+ */
+cb_result_code_t cb_stats_stream_final(const cb_stats_stream_t *stream,
+                                       cb_latency_stats_t *stats,
+                                       cb_fault_flags_t *faults);
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Mergeable Statistics (CB-MATH-001 §6.8)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Merge N partial latency statistics into one
+ *
+ * min/max/mean/variance merge exactly via pooled count/sum/
+ * sum-of-squared-deviation accumulators. Percentiles cannot be
+ * recovered exactly from summaries, so the maximum across parts is
+ * taken — a conservative upper bound suitable for certification
+ * evidence. Cost is O(num); no buffers required.
+ *
+ * @param parts  Array of partial statistics
+ * @param num    Number of parts (must be ≥ 1)
+ * @param out    Output merged statistics
+ * @param faults Fault flags (overflow, div_zero set on error)
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if any pointer is NULL
+ * @return CB_ERR_INVALID_CONFIG if num is 0
+ * @return CB_ERR_OVERFLOW if the parts hold no samples
+ *
+ * @traceability SRS-002-METRICS §4.7, CB-MATH-001 §6.8
+ */
+cb_result_code_t cb_stats_merge(const cb_latency_stats_t *parts,
+                                uint32_t num,
+                                cb_latency_stats_t *out,
+                                cb_fault_flags_t *faults);
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Histogram Construction (CB-MATH-001 §6.4)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -122,11 +263,44 @@ cb_result_code_t cb_histogram_init(cb_histogram_t *histogram,
                                    uint64_t min_ns,
                                    uint64_t max_ns);
 
+/**
+ * @brief Initialise logarithmic-bucket histogram (HDR-style)
+ *
+ * Lays out unit-width buckets [0, subbuckets) followed by one octave
+ * per power of two, each split into subbuckets_per_octave equal
+ * sub-buckets, covering the full uint64 nanosecond range. Relative
+ * bucket width is bounded by 1/subbuckets_per_octave everywhere, so a
+ * single configuration resolves microsecond bodies and millisecond
+ * tails in the same run. Sets bin_width_ns = 0 — the variable-width
+ * sentinel recognised by cb_histogram_build().
+ *
+ * Required capacity: subbuckets × (65 − log2(subbuckets)).
+ * With subbuckets = 4 that is 252 bins (~6 KB of bins).
+ *
+ * @param histogram             Output histogram structure
+ * @param bins                  Caller-provided bin array
+ * @param bins_capacity         Capacity of the bins array
+ * @param subbuckets_per_octave Sub-buckets per octave (power of two, 2-256)
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if histogram or bins is NULL
+ * @return CB_ERR_INVALID_CONFIG if subbuckets invalid or capacity too small
+ *
+ * @traceability SRS-002-METRICS §4.4
+ */
+cb_result_code_t cb_histogram_init_log(cb_histogram_t *histogram,
+                                       cb_histogram_bin_t *bins,
+                                       uint32_t bins_capacity,
+                                       uint32_t subbuckets_per_octave);
+
 /**
  * @brief Build histogram from samples
  *
  * Populates histogram bins from sample array. Tracks underflow and overflow.
- * Does not allocate memory — histogram must be initialised with cb_histogram_init().
+ * Does not allocate memory — histogram must be initialised with
+ * cb_histogram_init() or cb_histogram_init_log(). Linear histograms bin
+ * by an exact reciprocal multiply (one division per build, bit-identical
+ * counts to the per-sample division form); variable-width histograms
+ * (bin_width_ns == 0) bin by binary search over the bin bounds.
  *
  * @param samples   Array of latency measurements in nanoseconds
  * @param count     Number of samples
@@ -150,6 +324,10 @@ cb_result_code_t cb_histogram_build(const uint64_t *samples,
  *
  * Identifies samples with |modified Z-score| > 3.5.
  * Uses integer arithmetic scaled by 10000 to avoid floating-point.
+ * The flagging pass folds the per-sample division into one deviation
+ * cutoff and dispatches to AVX2/NEON where available; the scalar path
+ * is the certified reference and all paths produce bit-identical
+ * flags and counts.
  *
  * If MAD = 0 (all samples identical), no outliers are flagged.
  *
@@ -186,6 +364,29 @@ cb_result_code_t cb_detect_outliers(const uint64_t *samples,
  */
 void cb_sort_u64(uint64_t *arr, uint32_t count);
 
+/**
+ * @brief Sort array of uint64_t values using LSD radix sort
+ *
+ * Stable, deterministic O(n) sort over 8-bit digits with sequential
+ * memory access — an order of magnitude faster than heapsort on
+ * million-sample arrays. Requires a caller-provided scratch buffer of
+ * at least count elements (no dynamic allocation). Passes where all
+ * elements share a digit are skipped, so nanosecond-scale data needs
+ * only the low few passes.
+ *
+ * cb_sort_u64() selects this path automatically for large counts using
+ * internal static scratch; use this entry point directly to supply
+ * your own scratch buffer.
+ *
+ * @param arr     Array to sort (sorted in place)
+ * @param scratch Caller-provided scratch buffer (>= count elements)
+ * @param count   Number of elements
+ *
+ * @satisfies METRICS-NF-003
+ * @traceability SRS-002-METRICS §5.1
+ */
+void cb_sort_u64_radix(uint64_t *arr, uint64_t *scratch, uint32_t count);
+
 #ifdef __cplusplus
 }
 #endif
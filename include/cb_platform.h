@@ -16,6 +16,8 @@
 
 #include "cb_types.h"
 
+#include <pthread.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -84,7 +86,9 @@ bool cb_hwcounters_available(void);
  * @brief Start hardware counter collection
  *
  * Begins collecting hardware performance counters. Must be paired
- * with cb_hwcounters_stop().
+ * with cb_hwcounters_stop(). The six counters are scheduled as a
+ * single perf_event group, so they start, stop and read atomically —
+ * ratios such as IPC are free of multiplexing skew between events.
  *
  * @return CB_OK on success
  * @return CB_ERR_HWCOUNTERS if counters unavailable or already started
@@ -94,11 +98,47 @@ bool cb_hwcounters_available(void);
  */
 cb_result_code_t cb_hwcounters_start(void);
 
+/**
+ * @brief Read hardware counters without stopping collection
+ *
+ * Snapshots all six counters while they continue running, for
+ * per-iteration sampling. Uses the userspace RDPMC fast path via the
+ * perf mmap page where the kernel permits it, falling back to a
+ * single group-read syscall otherwise. Computes derived metrics
+ * (IPC, cache miss rate) in Q16.16 format.
+ *
+ * @param counters Output counter values (cumulative since start)
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if counters is NULL
+ * @return CB_ERR_HWCOUNTERS if counters weren't started
+ *
+ * @satisfies PLATFORM-F-022 through PLATFORM-F-026
+ * @traceability SRS-006-PLATFORM §4.2, CB-MATH-001 §7.2
+ */
+cb_result_code_t cb_hwcounters_read(cb_hwcounters_t *counters);
+
+/**
+ * @brief Check if the userspace counter-read fast path is present
+ *
+ * Reports whether the perf mmap pages needed for RDPMC-based reads
+ * were mapped at initialisation. The kernel may still withhold the
+ * capability per read; cb_hwcounters_read() degrades to the syscall
+ * path transparently in that case.
+ *
+ * @return true if all counter mmap pages are mapped (x86 Linux only)
+ *
+ * @satisfies PLATFORM-F-020
+ * @traceability SRS-006-PLATFORM §4.2
+ */
+bool cb_hwcounters_fast_available(void);
+
 /**
  * @brief Stop collection and read hardware counters
  *
- * Stops counter collection and populates the output structure.
- * Computes derived metrics (IPC, cache miss rate) in Q16.16 format.
+ * Disables the counter group atomically through the leader, then
+ * reads all six values in a single syscall and populates the output
+ * structure. Computes derived metrics (IPC, cache miss rate) in
+ * Q16.16 format.
  *
  * @param counters Output counter values
  * @return CB_OK on success
@@ -166,6 +206,132 @@ cb_result_code_t cb_env_compute_stats(const cb_env_snapshot_t *start,
  */
 bool cb_env_check_stable(const cb_env_stats_t *stats);
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Persistent Environmental Monitor (SRS-006-PLATFORM §4.7)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Continuous environmental monitor state
+ *
+ * Samples frequency, temperature and throttle state on a background
+ * thread at a fixed period, keeping the sysfs descriptors open across
+ * samples (pread, no open/close per read) so the measurement loop is
+ * never perturbed. Samples land in a caller-provided ring buffer;
+ * over-run extrema are tracked incrementally so they remain exact
+ * even after the ring wraps. No dynamic allocation.
+ *
+ * Initialise with cb_env_monitor_init(); treat the fields as
+ * read-only between init and stop.
+ *
+ * @traceability SRS-006-PLATFORM §4.7, CB-STRUCT-001 §6
+ */
+typedef struct {
+    cb_env_snapshot_t *ring;       /**< Caller-provided sample ring */
+    uint32_t ring_capacity;        /**< Ring slots (≥ 1) */
+    uint32_t period_ms;            /**< Sampling period in milliseconds */
+    volatile uint32_t sample_count; /**< Total samples since start */
+    volatile bool stop_requested;  /**< Sampler shutdown flag */
+    bool running;                  /**< Sampler thread is live */
+    bool have_freq;                /**< At least one non-zero freq read */
+    bool have_temp;                /**< At least one non-zero temp read */
+    int fd_freq;                   /**< Persistent sysfs fd (-1 = absent) */
+    int fd_temp;                   /**< Persistent sysfs fd (-1 = absent) */
+    int fd_throttle;               /**< Persistent sysfs fd (-1 = absent) */
+    uint32_t _padding;
+    cb_env_snapshot_t first;       /**< Earliest sample (survives wrap) */
+    cb_env_snapshot_t last;        /**< Most recent sample */
+    uint64_t min_freq_hz;          /**< Running frequency minimum */
+    uint64_t max_freq_hz;          /**< Running frequency maximum */
+    int32_t  min_temp_mC;          /**< Running temperature minimum */
+    int32_t  max_temp_mC;          /**< Running temperature maximum */
+    pthread_t thread;              /**< Sampler thread handle */
+} cb_env_monitor_t;
+
+/**
+ * @brief Initialise an environmental monitor
+ *
+ * Opens the sysfs data sources once and takes an immediate first
+ * sample. Sources that do not exist on this system are skipped and
+ * the corresponding snapshot fields read as 0, matching
+ * cb_env_snapshot() degradation.
+ *
+ * @param monitor       Monitor state to initialise
+ * @param ring          Caller-provided snapshot ring buffer
+ * @param ring_capacity Number of slots in ring (must be ≥ 1)
+ * @param period_ms     Sampling period in milliseconds (must be ≥ 1)
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if monitor or ring is NULL
+ * @return CB_ERR_INVALID_CONFIG if ring_capacity or period_ms is 0
+ *
+ * @satisfies PLATFORM-F-070, PLATFORM-F-071
+ * @traceability SRS-006-PLATFORM §4.7
+ */
+cb_result_code_t cb_env_monitor_init(cb_env_monitor_t *monitor,
+                                     cb_env_snapshot_t *ring,
+                                     uint32_t ring_capacity,
+                                     uint32_t period_ms);
+
+/**
+ * @brief Start background sampling
+ *
+ * Spawns the sampler thread. Must follow cb_env_monitor_init().
+ *
+ * @param monitor Initialised monitor
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if monitor is NULL
+ * @return CB_ERR_INVALID_CONFIG if not initialised or already running
+ *
+ * @satisfies PLATFORM-F-072
+ * @traceability SRS-006-PLATFORM §4.7
+ */
+cb_result_code_t cb_env_monitor_start(cb_env_monitor_t *monitor);
+
+/**
+ * @brief Stop sampling and produce over-run statistics
+ *
+ * Takes a final sample, joins the sampler thread, closes the sysfs
+ * descriptors and fills stats with the true extrema observed across
+ * every sample — min/max frequency and temperature reflect the whole
+ * run, not just the endpoints, so a transient mid-run throttle that
+ * recovers is still visible. The monitor must be re-initialised
+ * before reuse.
+ *
+ * @param monitor Running monitor
+ * @param stats   Output statistics (may be NULL to discard)
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if monitor is NULL
+ * @return CB_ERR_INVALID_CONFIG if the monitor was never started
+ *
+ * @satisfies PLATFORM-F-073 through PLATFORM-F-076
+ * @traceability SRS-006-PLATFORM §4.7, CB-MATH-001 §9.2
+ */
+cb_result_code_t cb_env_monitor_stop(cb_env_monitor_t *monitor,
+                                     cb_env_stats_t *stats);
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Cache Control (SRS-006-PLATFORM §4.8)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Flush a memory range from all cache levels
+ *
+ * Evicts every cache line covering [ptr, ptr + size) so the next
+ * access observes cold caches — the preconditioning primitive behind
+ * the runner's cold-cache measurement mode (SRS-003-RUNNER §4.14).
+ * Uses clflush on x86 and DC CIVAC on ARM64; platforms without a
+ * line-flush instruction fall back to a cache-filling sweep that
+ * displaces the range rather than flushing it precisely.
+ *
+ * @param ptr  Start of the range (any alignment)
+ * @param size Range length in bytes
+ * @return CB_OK on success (size 0 is a no-op)
+ * @return CB_ERR_NULL_PTR if ptr is NULL and size > 0
+ *
+ * @satisfies PLATFORM-F-080 through PLATFORM-F-082
+ * @traceability SRS-006-PLATFORM §4.8
+ */
+cb_result_code_t cb_cache_flush_range(const void *ptr, uint64_t size);
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Platform Initialisation
  *─────────────────────────────────────────────────────────────────────────────*/
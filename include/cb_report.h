@@ -25,6 +25,38 @@ extern "C" {
  * JSON Output (SRS-005-REPORT §4.1)
  *─────────────────────────────────────────────────────────────────────────────*/
 
+/** Worst-case JSON document size: the fixed sections plus a full
+ *  CB_MAX_HISTOGRAM histogram with per-bin bounds. A buffer of this
+ *  size always holds a complete report. */
+#define CB_JSON_MAX_SIZE 32768
+
+/**
+ * @brief Assemble the JSON document in a caller-provided buffer
+ *
+ * Builds the complete report in memory with no stdio and no dynamic
+ * allocation — integers are formatted with an internal decimal
+ * converter. Callers that manage their own I/O (sockets, O_DIRECT
+ * stores) can flush the buffer however they like; cb_write_json_fp()
+ * uses this internally and issues a single write.
+ *
+ * @param result   Benchmark result to serialise
+ * @param buf      Caller-provided output buffer
+ * @param capacity Buffer capacity in bytes (CB_JSON_MAX_SIZE always
+ *                 suffices)
+ * @param length   Receives the document length in bytes (no
+ *                 null terminator is appended)
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if result, buf, or length is NULL
+ * @return CB_ERR_OUT_OF_MEMORY if the document does not fit
+ *
+ * @satisfies REPORT-F-001 through REPORT-F-015, REPORT-NF-004
+ * @traceability SRS-005-REPORT §4.1
+ */
+cb_result_code_t cb_write_json_buf(const cb_result_t *result,
+                                   char *buf,
+                                   size_t capacity,
+                                   size_t *length);
+
 /**
  * @brief Write results to JSON file
  *
@@ -78,12 +110,133 @@ cb_result_code_t cb_write_csv(const cb_result_t *result, const char *path);
 /**
  * @brief Append result to existing CSV file (data row only)
  *
+ * The row is written with a single O_APPEND write(), which is atomic
+ * for regular files — concurrent appenders from different processes
+ * never produce torn or interleaved rows, with no locking.
+ *
  * @param result Benchmark result to append
  * @param path   Existing CSV file path
  * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if result or path is NULL
+ * @return CB_ERR_IO on file write failure
+ *
+ * @satisfies REPORT-F-027
+ * @traceability SRS-005-REPORT §4.9
  */
 cb_result_code_t cb_append_csv(const cb_result_t *result, const char *path);
 
+/**
+ * @brief Append result to this process's CSV shard
+ *
+ * Writes a data row to <base>.shard.<pid>.csv, so every process in a
+ * per-core fleet records results into its own file and completion is
+ * contention-free regardless of fleet width. Shards hold rows only;
+ * cb_csv_merge() produces the canonical header-led CSV.
+ *
+ * @param result Benchmark result to append
+ * @param base   Canonical CSV base path (shard files are siblings)
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if result or base is NULL
+ * @return CB_ERR_OVERFLOW if the shard path does not fit
+ * @return CB_ERR_IO on file write failure
+ *
+ * @satisfies REPORT-F-028
+ * @traceability SRS-005-REPORT §4.9
+ */
+cb_result_code_t cb_append_csv_shard(const cb_result_t *result,
+                                     const char *base);
+
+/**
+ * @brief Coalesce CSV shards into the canonical CSV
+ *
+ * Concatenates every <base>.shard.*.csv in shard-name order (stable
+ * across reruns) after a header row, writing the result to out_path.
+ * With remove_shards, shards are unlinked only after a clean merge, so
+ * a failed compaction never loses rows.
+ *
+ * @param base          Canonical CSV base path used by the appenders
+ * @param out_path      Merged CSV output path
+ * @param remove_shards Unlink shard files after a successful merge
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if base or out_path is NULL
+ * @return CB_ERR_OUT_OF_MEMORY if there are more shards than the
+ *         merge table holds (1024)
+ * @return CB_ERR_IO on read/write failure
+ *
+ * @satisfies REPORT-F-029
+ * @traceability SRS-005-REPORT §4.9
+ */
+cb_result_code_t cb_csv_merge(const char *base, const char *out_path,
+                              bool remove_shards);
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Binary Result Format (SRS-005-REPORT §4.6)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/** Binary result file magic: 'C' 'B' 'R' 'F' */
+#define CB_BINARY_MAGIC_0 0x43U
+#define CB_BINARY_MAGIC_1 0x42U
+#define CB_BINARY_MAGIC_2 0x52U
+#define CB_BINARY_MAGIC_3 0x46U
+
+/** Binary result format version */
+#define CB_BINARY_VERSION 1U
+
+/**
+ * @brief Fixed-size header of a .cbr binary result file
+ *
+ * The header is followed immediately by the raw little-endian
+ * cb_result_t payload. cb_result_t uses only fixed-size types with
+ * explicit padding, so the payload can be memory-mapped and read in
+ * place after header validation. The histogram bins pointer is zeroed
+ * before writing — pointers are never meaningful across processes.
+ *
+ * @traceability SRS-005-REPORT §4.6, CB-STRUCT-001 §14
+ */
+typedef struct {
+    uint8_t magic[4];        /**< CB_BINARY_MAGIC_0..3 */
+    uint32_t version;        /**< CB_BINARY_VERSION */
+    uint32_t payload_size;   /**< sizeof(cb_result_t) at write time */
+    uint32_t _padding;
+    cb_hash_t payload_hash;  /**< SHA-256 of the payload bytes */
+} cb_binary_header_t;
+
+/**
+ * @brief Write result to binary .cbr file
+ *
+ * Writes a cb_binary_header_t followed by the raw result structure.
+ * The payload is checksummed with SHA-256 so readers can validate
+ * integrity without parsing.
+ *
+ * @param result Benchmark result to serialise
+ * @param path   Output file path (conventionally .cbr)
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if result or path is NULL
+ * @return CB_ERR_IO on file write failure
+ *
+ * @traceability SRS-005-REPORT §4.6
+ */
+cb_result_code_t cb_write_binary(const cb_result_t *result, const char *path);
+
+/**
+ * @brief Load result from binary .cbr file
+ *
+ * Validates magic, version, payload size, and SHA-256 checksum before
+ * copying the payload into the caller's structure. A size mismatch
+ * means the file was written by an incompatible library build and is
+ * rejected rather than misread.
+ *
+ * @param path   Input file path
+ * @param result Output result structure
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if path or result is NULL
+ * @return CB_ERR_IO on file read failure
+ * @return CB_ERR_INVALID_CONFIG on bad magic, version, size, or checksum
+ *
+ * @traceability SRS-005-REPORT §4.6
+ */
+cb_result_code_t cb_load_binary(const char *path, cb_result_t *result);
+
 /*─────────────────────────────────────────────────────────────────────────────
  * JSON Loading (SRS-005-REPORT §4.3)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -131,6 +284,51 @@ cb_result_code_t cb_compare_results(const cb_result_t *result_a,
                                      const cb_result_t *result_b,
                                      cb_comparison_t *comparison);
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Fleet Result Merging (SRS-005-REPORT §4.8)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/** Maximum partial results accepted by cb_result_merge() */
+#define CB_MERGE_MAX_PARTIALS 256
+
+/**
+ * @brief Merge N partial results into one fleet-wide result
+ *
+ * Collapses per-node results from a distributed run into a single
+ * result using mergeable representations only: pooled count/sum/
+ * sum-of-squares accumulators for mean and variance (exact), min/max
+ * (exact), maximum across nodes for percentiles (conservative upper
+ * bound), and bin-wise count addition for the histogram. Cost is
+ * O(num × bins) total — no per-node samples are needed, so results
+ * read back with cb_load_json() merge directly.
+ *
+ * The merged histogram is produced only when bins is non-NULL and
+ * every partial carries a valid histogram with identical binning
+ * (range and bin width); otherwise histogram_valid is left false
+ * rather than summing incompatible bins.
+ *
+ * Platform identification and the config echo are taken from the
+ * first partial; fault flags are OR-ed across all partials.
+ *
+ * @param partials     Array of per-node results
+ * @param num          Number of partials (1..CB_MERGE_MAX_PARTIALS)
+ * @param merged       Output fleet result
+ * @param bins         Caller-provided bin buffer for the merged
+ *                     histogram (NULL to skip histogram merging)
+ * @param bin_capacity Slots in bins
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if partials or merged is NULL
+ * @return CB_ERR_INVALID_CONFIG if num is 0 or exceeds the maximum
+ *
+ * @satisfies REPORT-F-070 through REPORT-F-078
+ * @traceability SRS-005-REPORT §4.8, CB-MATH-001 §6.8
+ */
+cb_result_code_t cb_result_merge(const cb_result_t *partials,
+                                 uint32_t num,
+                                 cb_result_t *merged,
+                                 cb_histogram_bin_t *bins,
+                                 uint32_t bin_capacity);
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Human-Readable Output (SRS-005-REPORT §4.5)
  *─────────────────────────────────────────────────────────────────────────────*/
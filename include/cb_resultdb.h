@@ -0,0 +1,218 @@
+/**
+ * @file cb_resultdb.h
+ * @brief Indexed result database API
+ *
+ * Append-only store of serialised cb_result_t records with an
+ * mmap-able index sorted by (key, timestamp), for historical
+ * regression queries over large result histories. Range queries and
+ * latest-N baseline lookups are O(log n) binary searches instead of
+ * directory walks over individual JSON files.
+ *
+ * The database is two files: a data file of framed records (the
+ * cb_write_binary() format, so each record carries its own integrity
+ * hash) and an index file of cb_resultdb_entry_t kept sorted on disk.
+ *
+ * @traceability SRS-008-RESULTDB, CB-STRUCT-001 §10
+ *
+ * Copyright © 2026 The Murray Family Innovation Trust. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef CB_RESULTDB_H
+#define CB_RESULTDB_H
+
+#include "cb_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Database Lifecycle (SRS-008-RESULTDB §4.1)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Open (or create) a result database
+ *
+ * Opens the data and index files, creating empty ones when absent,
+ * and maps the index read-write. The index magic and version are
+ * checked so an incompatible layout is rejected rather than
+ * misinterpreted.
+ *
+ * @param db         Handle to fill
+ * @param data_path  Path to the append-only record file
+ * @param index_path Path to the sorted index file
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if any pointer is NULL
+ * @return CB_ERR_IO if a file cannot be opened or mapped
+ * @return CB_ERR_INVALID_CONFIG if the index has the wrong magic or
+ *         version
+ *
+ * @satisfies RESULTDB-F-001 through RESULTDB-F-004
+ * @traceability SRS-008-RESULTDB §4.1
+ */
+cb_result_code_t cb_resultdb_open(cb_resultdb_t *db,
+                                  const char *data_path,
+                                  const char *index_path);
+
+/**
+ * @brief Close a database handle
+ *
+ * Unmaps the index and closes both files. The handle must be
+ * re-opened before further use.
+ *
+ * @param db Handle to close
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if db is NULL
+ * @return CB_ERR_INVALID_CONFIG if the handle is not open
+ *
+ * @satisfies RESULTDB-F-005
+ * @traceability SRS-008-RESULTDB §4.1
+ */
+cb_result_code_t cb_resultdb_close(cb_resultdb_t *db);
+
+/**
+ * @brief Number of records in the database
+ *
+ * @param db Open handle
+ * @return Record count, or 0 if db is NULL or not open
+ *
+ * @satisfies RESULTDB-F-006
+ * @traceability SRS-008-RESULTDB §4.1
+ */
+uint64_t cb_resultdb_count(const cb_resultdb_t *db);
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Keys and Insertion (SRS-008-RESULTDB §4.2)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Derive the 64-bit index key for a result identity
+ *
+ * Key = first 8 bytes (little-endian) of SHA256(platform || NUL ||
+ * cpu_model || NUL || model_hash). Results from the same platform,
+ * CPU, and model always land on the same key, so a baseline lookup is
+ * one binary search.
+ *
+ * @param platform   Platform string
+ * @param cpu_model  CPU model string
+ * @param model_hash Model/output content hash
+ * @param key        Receives the key
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if any pointer is NULL
+ *
+ * @satisfies RESULTDB-F-010
+ * @traceability SRS-008-RESULTDB §4.2, CB-MATH-001 §8.1
+ */
+cb_result_code_t cb_resultdb_make_key(const char *platform,
+                                      const char *cpu_model,
+                                      const cb_hash_t *model_hash,
+                                      uint64_t *key);
+
+/**
+ * @brief Append a result and insert its index entry in sorted order
+ *
+ * The record is framed exactly as cb_write_binary() (header with
+ * payload hash, then the payload) and appended to the data file; the
+ * index entry — keyed on (platform, cpu_model, output_hash) with the
+ * result's timestamp_unix — is inserted at its sorted position.
+ *
+ * @param db     Open handle
+ * @param result Result to store
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if db or result is NULL
+ * @return CB_ERR_INVALID_CONFIG if the handle is not open
+ * @return CB_ERR_IO on write or remap failure
+ *
+ * @satisfies RESULTDB-F-011 through RESULTDB-F-014
+ * @traceability SRS-008-RESULTDB §4.2
+ */
+cb_result_code_t cb_resultdb_append(cb_resultdb_t *db,
+                                    const cb_result_t *result);
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Queries (SRS-008-RESULTDB §4.3)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Range query: entries for a key within [ts_min, ts_max]
+ *
+ * Binary-searches the sorted index for the first entry of the key at
+ * or after ts_min, then copies matching entries in ascending
+ * timestamp order into the caller-provided array.
+ *
+ * @param db       Open handle
+ * @param key      Index key from cb_resultdb_make_key()
+ * @param ts_min   Inclusive lower timestamp bound
+ * @param ts_max   Inclusive upper timestamp bound
+ * @param entries  Caller-provided output array
+ * @param capacity Capacity of entries
+ * @param count    Receives the number of entries returned
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if db, entries, or count is NULL
+ * @return CB_ERR_INVALID_CONFIG if the handle is not open
+ * @return CB_ERR_OUT_OF_MEMORY if more matches exist than capacity
+ *
+ * @satisfies RESULTDB-F-020, RESULTDB-F-021
+ * @traceability SRS-008-RESULTDB §4.3
+ */
+cb_result_code_t cb_resultdb_query(const cb_resultdb_t *db,
+                                   uint64_t key,
+                                   uint64_t ts_min,
+                                   uint64_t ts_max,
+                                   cb_resultdb_entry_t *entries,
+                                   uint32_t capacity,
+                                   uint32_t *count);
+
+/**
+ * @brief Latest-N lookup: most recent entries for a key
+ *
+ * Walks backwards from the key's newest entry, returning up to n
+ * entries in descending timestamp order — the baseline set for a
+ * regression gate.
+ *
+ * @param db      Open handle
+ * @param key     Index key from cb_resultdb_make_key()
+ * @param n       Maximum entries to return
+ * @param entries Caller-provided output array (capacity >= n)
+ * @param count   Receives the number of entries returned
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if db, entries, or count is NULL
+ * @return CB_ERR_INVALID_CONFIG if the handle is not open
+ *
+ * @satisfies RESULTDB-F-022
+ * @traceability SRS-008-RESULTDB §4.3
+ */
+cb_result_code_t cb_resultdb_latest(const cb_resultdb_t *db,
+                                    uint64_t key,
+                                    uint32_t n,
+                                    cb_resultdb_entry_t *entries,
+                                    uint32_t *count);
+
+/**
+ * @brief Load the full record behind an index entry
+ *
+ * Reads the framed record at entry->offset from the data file and
+ * verifies its payload hash, exactly as cb_load_binary().
+ *
+ * @param db     Open handle
+ * @param entry  Index entry from a query
+ * @param result Receives the stored result
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if any pointer is NULL
+ * @return CB_ERR_INVALID_CONFIG if the handle is not open or the
+ *         record fails framing or integrity checks
+ * @return CB_ERR_IO on read failure
+ *
+ * @satisfies RESULTDB-F-023
+ * @traceability SRS-008-RESULTDB §4.3
+ */
+cb_result_code_t cb_resultdb_load(const cb_resultdb_t *db,
+                                  const cb_resultdb_entry_t *entry,
+                                  cb_result_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_RESULTDB_H */
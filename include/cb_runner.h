@@ -31,9 +31,14 @@ extern "C" {
  *   - warmup_iterations: 100
  *   - measure_iterations: 1000
  *   - batch_size: 1
+ *   - timing_batch: 1 (one inference call per timestamp pair)
  *   - timer_source: CB_TIMER_AUTO
  *   - verify_outputs: true
  *   - monitor_environment: true
+ *   - adaptive_stop: false (ci_rel_q16: 655 ≈ 1%, checked every 256
+ *     samples after the first 100, when enabled)
+ *   - adaptive_warmup: false (warmup_window: 16, warmup_drift_q16:
+ *     1311 ≈ 2%, when enabled)
  *
  * @param config Configuration to initialise
  * @return CB_OK on success
@@ -95,6 +100,14 @@ cb_result_code_t cb_runner_init(cb_runner_t *runner,
  * Runs warmup_iterations iterations without recording timing.
  * Stabilises caches, branch predictors, and frequency scaling.
  *
+ * With config.adaptive_warmup, warmup_iterations becomes a hard cap
+ * rather than a fixed count: each call is timed, and warmup ends once
+ * the relative drift between consecutive rolling-window means (of
+ * warmup_window iterations each) falls below warmup_drift_q16. The
+ * number of iterations actually consumed is recorded in cb_result_t
+ * (warmup_consumed), so over-provisioned warmup budgets stop costing
+ * wall-clock time on hosts that settle quickly.
+ *
  * @param runner     Initialised runner
  * @param fn         Inference function to call
  * @param ctx        User context passed to inference function
@@ -127,8 +140,37 @@ cb_result_code_t cb_runner_warmup(cb_runner_t *runner,
  *   t_end = timer_now()
  *   samples[i] = t_end - t_start
  *
+ * With config.timing_batch = k > 1, each timestamp pair brackets k
+ * back-to-back inference calls and samples[i] = (t_end - t_start) / k,
+ * amortizing timer overhead for sub-microsecond kernels. Samples are
+ * per-call means, so the stats layer treats them uniformly; compare
+ * cb_timer_calibration_ns() against the kernel latency when choosing k.
+ *
  * Verification (if enabled) occurs outside the critical timing path.
  *
+ * With config.adaptive_stop, measure_iterations becomes a cap rather
+ * than a fixed count: every ci_check_interval samples (after
+ * ci_min_iterations) the relative 95% CI half-width of the mean is
+ * evaluated from a running integer Welford accumulator, and the loop
+ * stops once it reaches ci_rel_q16. The achieved precision and
+ * whether the stop fired are recorded in cb_result_t
+ * (ci_achieved_q16, stopped_early). Quiet hosts converge in a
+ * fraction of the cap; noisy hosts run to the cap as before.
+ *
+ * Per-phase wall time (warmup, timed regions, verification, stats
+ * bookkeeping) is accumulated into cb_result_t.overhead (§4.12), so a
+ * run quantifies its own harness overhead: total_ns − timed_ns is
+ * everything spent outside the measured inferences, demonstrating the
+ * non-interference invariant (CB-MATH-001 §7.2) with numbers.
+ *
+ * With config.forensic_threshold_ns > 0 and a caller-provided
+ * forensic_ring, samples at or above the threshold additionally
+ * capture their iteration index, hardware counter deltas (when a
+ * counter group is running) and an environmental snapshot (§4.15) —
+ * context for diagnosing tail spikes without external tracing. The
+ * check on the non-outlier path is a single compare against a
+ * precomputed raw-unit threshold, so the distribution is undisturbed.
+ *
  * @param runner     Initialised runner (warmup should be complete)
  * @param fn         Inference function to call
  * @param ctx        User context passed to inference function
@@ -178,6 +220,232 @@ cb_result_code_t cb_runner_get_result(const cb_runner_t *runner,
  */
 void cb_runner_cleanup(cb_runner_t *runner);
 
+/**
+ * @brief Execute measurement phase with pipelined verification
+ *
+ * Behaves like cb_runner_execute() but overlaps output hashing with
+ * inference: the measurement loop writes into two alternating
+ * caller-provided output buffers while a verification worker thread
+ * drains the other buffer through cb_verify_ctx_update(). Outputs are
+ * hashed strictly in iteration order, so the final output hash is
+ * identical to the synchronous path.
+ *
+ * The critical loop structure (CB-MATH-001 §7.2) is preserved — buffer
+ * handoff synchronisation occurs between iterations, outside the timed
+ * region. With verification disabled (or output_size == 0) this is
+ * equivalent to cb_runner_execute() using output_a. Configurations the
+ * pipelined loop does not implement — batched timing, adaptive
+ * stopping, cold-cache mode (§4.14) — also take the synchronous path,
+ * so their semantics (and the modes stamped on the result) always
+ * match what was actually run.
+ *
+ * @param runner      Initialised runner (warmup should be complete)
+ * @param fn          Inference function to call
+ * @param ctx         User context passed to inference function
+ * @param input       Input buffer
+ * @param input_size  Size of input buffer
+ * @param output_a    First output buffer
+ * @param output_b    Second output buffer (must not alias output_a)
+ * @param output_size Size of each output buffer
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if any required pointer is NULL
+ * @return CB_ERR_INVALID_CONFIG if worker thread creation fails
+ * @return Other error codes from inference function
+ *
+ * @traceability SRS-003-RUNNER §4.8, CB-MATH-001 §7.2
+ */
+cb_result_code_t cb_runner_execute_pipelined(cb_runner_t *runner,
+                                             cb_inference_fn fn,
+                                             void *ctx,
+                                             const void *input,
+                                             uint32_t input_size,
+                                             void *output_a,
+                                             void *output_b,
+                                             uint32_t output_size);
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Streaming Throughput (SRS-003-RUNNER §4.16)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Execute the measurement phase streaming over a mapped corpus
+ *
+ * Walks a memory-mapped data set (cb_data_map()) instead of re-feeding
+ * one hot input buffer: each iteration's input is the next record,
+ * advancing stride records per iteration and wrapping at the corpus
+ * end, so the cache pressure of real input traffic is part of the
+ * measurement. With prefetch, non-blocking hints for iteration i+1's
+ * input are issued at the top of iteration i's timed region and the
+ * loads overlap the inference — the pipelining a streaming service
+ * actually runs with.
+ *
+ * cb_result_t.throughput is then MEASURED over the wall clock of the
+ * whole streaming phase (sustained inferences/sec, and bytes/sec of
+ * input actually streamed), not derived from summed sample latencies;
+ * result->streaming records the mode so the two are never conflated.
+ * Per-sample latency statistics and verification evidence are
+ * collected exactly as in cb_runner_execute().
+ *
+ * @param runner      Initialised runner (warmup runs on the first
+ *                    record if not already complete)
+ * @param fn          Inference function to call
+ * @param ctx         User context passed to the inference function
+ * @param map         Live read-only mapping of the input corpus
+ * @param record_size Bytes per input record (must divide into the
+ *                    mapping at least once)
+ * @param stride      Records advanced per iteration (0 treated as 1)
+ * @param prefetch    Issue software prefetch for the next input
+ * @param output      Output buffer
+ * @param output_size Size of output buffer
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if runner, fn or map is NULL
+ * @return CB_ERR_INVALID_CONFIG if the mapping is not live, holds no
+ *         complete record, or cold_cache is enabled (this loop does
+ *         no per-iteration flushes, so cold-start streaming would be
+ *         mislabelled warm-path data)
+ * @return Other error codes from underlying operations
+ *
+ * @satisfies RUNNER-F-100 through RUNNER-F-104
+ * @traceability SRS-003-RUNNER §4.16, SRS-007-DATA §4.3
+ */
+cb_result_code_t cb_runner_execute_streaming(cb_runner_t *runner,
+                                             cb_inference_fn fn,
+                                             void *ctx,
+                                             const cb_data_map_t *map,
+                                             uint32_t record_size,
+                                             uint32_t stride,
+                                             bool prefetch,
+                                             void *output,
+                                             uint32_t output_size);
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Interleaved A/B Execution (SRS-003-RUNNER §4.10)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief One variant of an interleaved A/B comparison
+ *
+ * Each variant owns its buffers and verification evidence — nothing
+ * is shared between A and B except the thermal environment. All
+ * buffers are caller-provided per the no-allocation rule.
+ *
+ * @traceability SRS-003-RUNNER §4.10
+ */
+typedef struct {
+    cb_inference_fn fn;          /**< Variant inference function */
+    void *ctx;                   /**< Variant inference context */
+    const void *input;           /**< Variant input buffer */
+    void *output;                /**< Variant output buffer */
+    uint64_t *samples;           /**< Variant sample buffer */
+    uint32_t sample_capacity;    /**< Sample buffer capacity */
+    uint32_t _padding;
+} cb_ab_variant_t;
+
+/**
+ * @brief Benchmark two inference functions interleaved in one session
+ *
+ * Alternates blocks of block_size iterations of A and B within a
+ * single measurement session, so both variants see the same frequency
+ * and thermal trajectory. Running A and B back-to-back lets drift
+ * between the two runs swamp small regressions; interleaving pairs
+ * the conditions, so paired-difference statistics on the two results
+ * reach significance with far fewer total iterations.
+ *
+ * Each variant keeps its own sample buffer and verification context;
+ * both results carry the same certification evidence as independent
+ * runs. Warmup runs once per variant before measurement begins. The
+ * critical-loop invariant (CB-MATH-001 §7.2) holds within each block,
+ * including batched timing when config->timing_batch > 1.
+ *
+ * @param config      Benchmark configuration (shared by both variants)
+ * @param variant_a   First variant (buffers and function)
+ * @param variant_b   Second variant (buffers and function)
+ * @param input_size  Size of each variant's input buffer
+ * @param output_size Size of each variant's output buffer
+ * @param block_size  Iterations per alternation block (0 treated as 1)
+ * @param result_a    Output result for variant A
+ * @param result_b    Output result for variant B
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if any required pointer is NULL
+ * @return CB_ERR_INVALID_CONFIG if a sample buffer is too small
+ * @return Other error codes from underlying operations
+ *
+ * @satisfies RUNNER-F-090 through RUNNER-F-095
+ * @traceability SRS-003-RUNNER §4.10, CB-MATH-001 §7.2
+ */
+cb_result_code_t cb_runner_execute_interleaved(const cb_config_t *config,
+                                               const cb_ab_variant_t *variant_a,
+                                               const cb_ab_variant_t *variant_b,
+                                               uint32_t input_size,
+                                               uint32_t output_size,
+                                               uint32_t block_size,
+                                               cb_result_t *result_a,
+                                               cb_result_t *result_b);
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Parallel Execution API (SRS-003-RUNNER §4.7)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Per-core worker description for parallel execution
+ *
+ * Each worker owns its buffers — no sharing between cores. All buffers
+ * are caller-provided per the no-allocation rule.
+ *
+ * @traceability SRS-003-RUNNER §4.7
+ */
+typedef struct {
+    uint32_t core_id;            /**< CPU core to pin this worker to */
+    uint32_t _padding1;
+    void *ctx;                   /**< Per-worker inference context */
+    const void *input;           /**< Per-worker input buffer */
+    void *output;                /**< Per-worker output buffer */
+    uint64_t *samples;           /**< Per-worker sample buffer */
+    uint32_t sample_capacity;    /**< Sample buffer capacity */
+    uint32_t _padding2;
+} cb_parallel_worker_t;
+
+/**
+ * @brief Execute benchmark on multiple cores concurrently
+ *
+ * Spawns one worker thread per entry in the workers array, pins each to
+ * its configured core (best effort on non-Linux platforms), and runs the
+ * full warmup + measurement sequence independently on each. Each worker
+ * maintains its own sample buffer and verification context, so per-core
+ * results carry the same certification evidence as a single-core run.
+ *
+ * Because all cores execute simultaneously, the per-core results reflect
+ * cross-core interference (shared LLC and memory-bandwidth contention)
+ * that sequential one-core-at-a-time runs cannot observe.
+ *
+ * The aggregate result combines per-core statistics conservatively:
+ * min/max/mean/variance are merged exactly; percentiles are taken as the
+ * maximum across cores (an upper bound, never an underestimate).
+ *
+ * @param config      Benchmark configuration (shared by all workers)
+ * @param fn          Inference function (must be thread-safe w.r.t. ctx)
+ * @param workers     Array of per-core worker descriptions
+ * @param num_workers Number of workers
+ * @param input_size  Size of each worker's input buffer
+ * @param output_size Size of each worker's output buffer
+ * @param results     Output array of per-core results [num_workers]
+ * @param aggregate   Optional combined result (NULL to skip)
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if config, fn, workers, or results is NULL
+ * @return CB_ERR_INVALID_CONFIG if num_workers is 0 or a worker buffer is invalid
+ * @return First worker error code if any worker fails
+ *
+ * @traceability SRS-003-RUNNER §4.7, CB-MATH-001 §7
+ */
+cb_result_code_t cb_runner_execute_parallel(const cb_config_t *config,
+                                            cb_inference_fn fn,
+                                            cb_parallel_worker_t *workers,
+                                            uint32_t num_workers,
+                                            uint32_t input_size,
+                                            uint32_t output_size,
+                                            cb_result_t *results,
+                                            cb_result_t *aggregate);
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Convenience API (SRS-003-RUNNER §4.2)
  *─────────────────────────────────────────────────────────────────────────────*/
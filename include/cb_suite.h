@@ -0,0 +1,103 @@
+/**
+ * @file cb_suite.h
+ * @brief Multi-configuration suite driver API
+ *
+ * Runs an array of benchmark configurations sequentially in one
+ * process, so fixed setup — process startup, platform identification,
+ * timer calibration — is paid once instead of once per configuration.
+ * Each run's JSON serialisation is handed to a double-buffered writer
+ * thread and overlaps the next run's warmup phase; an aggregate suite
+ * report summarises every run alongside the per-run reports.
+ *
+ * @traceability SRS-009-SUITE
+ *
+ * Copyright © 2026 The Murray Family Innovation Trust. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef CB_SUITE_H
+#define CB_SUITE_H
+
+#include "cb_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Suite Entries (SRS-009-SUITE §4.1)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief One entry of a benchmark suite
+ *
+ * Each entry owns its configuration, inference function and buffers —
+ * all caller-provided per the no-allocation rule. config.output_path
+ * names the per-run JSON report (NULL = no per-run report); sample
+ * buffers may be shared between entries because runs are sequential.
+ *
+ * @traceability SRS-009-SUITE §4.1
+ */
+typedef struct {
+    const char *name;            /**< Entry name in the suite report
+                                      (NULL = the entry index) */
+    cb_config_t config;          /**< Per-run configuration */
+    cb_inference_fn fn;          /**< Inference function */
+    void *ctx;                   /**< Inference context */
+    const void *input;           /**< Input buffer */
+    void *output;                /**< Output buffer */
+    uint32_t input_size;         /**< Size of input buffer */
+    uint32_t output_size;        /**< Size of output buffer */
+    uint64_t *samples;           /**< Caller-provided sample buffer */
+    uint32_t sample_capacity;    /**< Sample buffer capacity */
+    uint32_t _padding;
+} cb_suite_entry_t;
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Suite Execution (SRS-009-SUITE §4.2)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Run a suite of benchmark configurations in one process
+ *
+ * Validates every configuration up front, initialises the timer once
+ * (subsequent per-run initialisations short-circuit, so calibration
+ * is not repeated), then runs the entries sequentially. After each
+ * run completes, its result is handed to a writer thread that
+ * serialises the per-run JSON while the next entry warms up — report
+ * I/O never sits between two measurement phases.
+ *
+ * Runs whose results are invalid (faults, verification failures) are
+ * counted but do not stop the suite; setup errors do. On return,
+ * results[i] holds the complete result of entry i regardless of
+ * validity.
+ *
+ * The aggregate report at report_path summarises every run — name,
+ * key latency and throughput figures, validity — plus suite totals
+ * (entries, failures, wall time). NULL skips the aggregate report.
+ *
+ * @param entries     Array of suite entries
+ * @param num_entries Number of entries (must be > 0)
+ * @param results     Output array, one result per entry
+ * @param report_path Path for the aggregate suite report (NULL = none)
+ * @return CB_OK on success (even with invalid runs counted)
+ * @return CB_ERR_NULL_PTR if entries, results, an entry's fn or an
+ *         entry's sample buffer is NULL
+ * @return CB_ERR_INVALID_CONFIG if any entry fails validation or the
+ *         writer thread cannot be started
+ * @return CB_ERR_IO if a per-run or aggregate report cannot be written
+ * @return Other error codes from underlying operations
+ *
+ * @satisfies SUITE-F-001 through SUITE-F-006
+ * @traceability SRS-009-SUITE §4.2
+ */
+cb_result_code_t cb_suite_run(const cb_suite_entry_t *entries,
+                              uint32_t num_entries,
+                              cb_result_t *results,
+                              const char *report_path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_SUITE_H */
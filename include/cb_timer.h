@@ -33,6 +33,11 @@ extern "C" {
  * When CB_TIMER_AUTO is specified, selects the highest-resolution
  * available timer with priority: platform cycle counter → POSIX.
  *
+ * Calling again with the same requested source is a no-op and returns
+ * the already-selected backend — repeated runs in one process (suite
+ * execution, SRS-009-SUITE) calibrate once. Requesting a different
+ * source re-initialises and re-calibrates.
+ *
  * @param source Preferred timer source (CB_TIMER_AUTO recommended)
  * @return Actual timer source selected
  *
@@ -58,6 +63,79 @@ cb_timer_source_t cb_timer_init(cb_timer_source_t source);
  */
 uint64_t cb_timer_now_ns(void);
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Fast-Path Timestamp Acquisition (SRS-001-TIMER §4.6)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Resolved-backend handle for the inline fast-path read
+ *
+ * Snapshots the backend selected by cb_timer_init() so the measurement
+ * loop avoids the out-of-line call and per-read dispatch of
+ * cb_timer_now_ns(). Valid until the next cb_timer_init().
+ *
+ * @traceability SRS-001-TIMER §4.6, CB-STRUCT-001 §8
+ */
+typedef struct {
+    cb_timer_source_t source;  /**< Backend resolved at init */
+    uint32_t _padding;
+} cb_timer_fast_t;
+
+/**
+ * @brief Initialise a fast-path timer handle
+ *
+ * Caches the active backend. cb_timer_init() must have been called.
+ *
+ * @param fast Handle to initialise
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if fast is NULL
+ * @return CB_ERR_TIMER_INIT if the timer subsystem is not initialised
+ *
+ * @traceability SRS-001-TIMER §4.6
+ */
+cb_result_code_t cb_timer_fast_init(cb_timer_fast_t *fast);
+
+/**
+ * @brief Read the cached backend — RAW units, inline
+ *
+ * On cycle-counter backends this compiles to the bare serialised
+ * counter-read instructions; the return value is in CYCLES, not
+ * nanoseconds. Convert stored deltas afterwards with
+ * cb_cycles_to_ns(), outside the measurement loop (deferred
+ * conversion). On the POSIX backend raw units are already
+ * nanoseconds, and cb_cycles_to_ns() is the identity.
+ *
+ * @param fast Initialised fast-path handle
+ * @return Timestamp in backend-native raw units
+ *
+ * @satisfies TIMER-F-010, TIMER-NF-003
+ * @traceability SRS-001-TIMER §4.6, CB-MATH-001 §7.2
+ */
+static inline uint64_t cb_timer_fast_read(const cb_timer_fast_t *fast)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if (fast->source == CB_TIMER_RDTSC) {
+        uint32_t lo, hi;
+        __asm__ volatile("lfence\n\trdtsc" : "=a"(lo), "=d"(hi));
+        return ((uint64_t)hi << 32) | lo;
+    }
+#elif defined(__aarch64__)
+    if (fast->source == CB_TIMER_CNTVCT) {
+        uint64_t value;
+        __asm__ volatile("isb\n\tmrs %0, cntvct_el0" : "=r"(value));
+        return value;
+    }
+#elif defined(__riscv) && (__riscv_xlen == 64)
+    if (fast->source == CB_TIMER_RISCV_CYCLE) {
+        uint64_t value;
+        __asm__ volatile("rdcycle %0" : "=r"(value));
+        return value;
+    }
+#endif
+    /* POSIX (and RV32) path: out-of-line read, raw units = ns */
+    return cb_timer_now_ns();
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Timer Resolution (SRS-001-TIMER §4.3)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -227,6 +227,51 @@ typedef struct {
     cb_histogram_bin_t *bins;  /**< Caller-provided bin array */
 } cb_histogram_t;
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Streaming Statistics (CB-MATH-001 §6.7)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief P²-style streaming quantile estimator state
+ *
+ * Five-marker quantile estimator using integer arithmetic only.
+ * Desired marker positions are scaled by 200 so the fractional
+ * increments of the P² algorithm stay integral.
+ *
+ * @traceability CB-STRUCT-001 §4, CB-MATH-001 §6.7
+ */
+typedef struct {
+    int64_t q[5];              /**< Marker heights (ns) */
+    int64_t n[5];              /**< Actual marker positions (1-based) */
+    int64_t d[5];              /**< Desired positions, scaled ×200 */
+    uint32_t percentile;       /**< Target percentile (0-100) */
+    uint32_t seeded;           /**< Observations seen during seeding (< 5) */
+} cb_quantile_est_t;
+
+/**
+ * @brief Streaming statistics accumulator
+ *
+ * Constant-memory alternative to cb_compute_stats() for runs whose
+ * sample count exceeds CB_MAX_SAMPLES. Mean and variance use integer
+ * Welford accumulation; percentiles use P²-style estimation and are
+ * therefore approximations (exact for the first 5 samples).
+ *
+ * @traceability CB-STRUCT-001 §4, CB-MATH-001 §6.7
+ */
+typedef struct {
+    uint64_t count;            /**< Samples observed */
+    uint64_t min_ns;           /**< Minimum observed */
+    uint64_t max_ns;           /**< Maximum observed */
+    uint64_t sum_ns;           /**< Running sum (overflow-checked) */
+    int64_t welford_m;         /**< Welford running mean */
+    int64_t welford_s;         /**< Welford Σ(squared deviations) */
+    cb_quantile_est_t p50;     /**< Median estimator */
+    cb_quantile_est_t p95;     /**< 95th percentile estimator */
+    cb_quantile_est_t p99;     /**< 99th percentile estimator */
+    cb_fault_flags_t faults;   /**< Accumulated faults */
+    uint32_t _padding;
+} cb_stats_stream_t;
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Cryptographic Structures (CB-MATH-001 §8)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -262,8 +307,94 @@ typedef struct {
     uint32_t sample_count;     /**< Expected number of outputs */
     uint32_t output_size;      /**< Size of each output in bytes */
     char platform[CB_MAX_PLATFORM];  /**< Platform that generated golden */
+
+    /* Chunked hash tree (CB-MATH-001 §8.4); all-zero when the golden
+     * predates chunked hashing or was generated without it */
+    cb_hash_t tree_root;       /**< Root over independent chunk hashes */
+    uint32_t chunk_size;       /**< Chunk size in bytes (0 = no tree) */
+    uint32_t num_chunks;       /**< Number of chunks the root covers */
 } cb_golden_ref_t;
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Overhead Accounting (CB-MATH-001 §7.2, SRS-003-RUNNER §4.12)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Per-phase harness overhead accounting
+ *
+ * Wall time attributed to each phase of a run, so "how much of this
+ * run was harness versus model" has a numeric answer and the
+ * non-interference invariant (CB-MATH-001 §7.2) can be demonstrated:
+ * total_ns − timed_ns is everything the harness did around the
+ * measured inferences.
+ *
+ * @traceability CB-STRUCT-001 §11, CB-MATH-001 §7.2
+ */
+typedef struct {
+    uint64_t warmup_ns;        /**< Warmup phase (incl. isolation setup) */
+    uint64_t timed_ns;         /**< Inside the critical timed regions */
+    uint64_t verify_ns;        /**< Output hashing between iterations */
+    uint64_t stats_ns;         /**< Sample bookkeeping and CI updates */
+    uint64_t total_ns;         /**< Warmup plus measurement phase wall */
+} cb_overhead_t;
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Data Mapping Structures (CB-STRUCT-001 §9)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Read-only memory-mapped view of a model or data file
+ *
+ * Filled by cb_data_map(); the mapping is owned by the kernel page
+ * cache, so no copy of the file contents is ever made.
+ *
+ * @traceability CB-STRUCT-001 §9, SRS-007-DATA §4.1
+ */
+typedef struct {
+    const void *base;          /**< Mapped base address (read-only) */
+    uint64_t size;             /**< File size in bytes */
+    bool mapped;               /**< Mapping is live */
+    bool prefaulted;           /**< Pages were prefaulted at map time */
+    uint8_t _padding[6];
+} cb_data_map_t;
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Result Database Structures (CB-STRUCT-001 §10)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief One entry of the sorted result-database index
+ *
+ * Entries are ordered by (key_hash, timestamp_unix) so both range
+ * queries and latest-N lookups are binary searches. The on-disk index
+ * is an array of these directly behind a small header — mmap-able
+ * with no parsing step.
+ *
+ * @traceability CB-STRUCT-001 §10, SRS-008-RESULTDB §4.2
+ */
+typedef struct {
+    uint64_t key_hash;         /**< 64-bit key of (platform, cpu_model,
+                                    model hash) */
+    uint64_t timestamp_unix;   /**< Result timestamp */
+    uint64_t offset;           /**< Record offset in the data file */
+} cb_resultdb_entry_t;
+
+/**
+ * @brief Open result database handle
+ *
+ * Filled by cb_resultdb_open(); treat as opaque.
+ *
+ * @traceability CB-STRUCT-001 §10, SRS-008-RESULTDB §4.1
+ */
+typedef struct {
+    void *index_base;          /**< mmap'd index file (header + entries) */
+    uint64_t index_size;       /**< Mapped size in bytes */
+    int data_fd;               /**< Append-only data file descriptor */
+    int index_fd;              /**< Index file descriptor */
+    bool open;                 /**< Handle is live */
+    uint8_t _padding[7];
+} cb_resultdb_t;
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Environmental Structures (CB-MATH-001 §9)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -341,6 +472,34 @@ typedef struct {
     uint32_t cache_miss_rate_q16;  /**< Miss rate (Q16.16, 0-65536 = 0-100%) */
 } cb_hwcounters_t;
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Outlier Forensics (SRS-003-RUNNER §4.15)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Forensic context for one tail-latency sample
+ *
+ * Captured by the runner when a sample exceeds the configured
+ * forensic threshold: the iteration index, the hardware counter
+ * deltas accumulated since the previous capture (or since
+ * measurement start, for the first capture), and an environmental
+ * snapshot taken at capture time. Counter deltas are zero when the
+ * caller did not start a counter group. Dividing a delta by the
+ * iterations elapsed since the previous record gives per-iteration
+ * rates around the spike.
+ *
+ * @traceability CB-STRUCT-001 §7, SRS-003-RUNNER §4.15
+ */
+typedef struct {
+    uint32_t iteration;        /**< Measurement iteration index */
+    uint32_t _padding;
+    uint64_t latency_ns;       /**< Per-call latency of the sample */
+    uint64_t cycles;           /**< CPU cycles since previous capture */
+    uint64_t instructions;     /**< Instructions since previous capture */
+    uint64_t cache_misses;     /**< Cache misses since previous capture */
+    cb_env_snapshot_t env;     /**< Environment at capture time */
+} cb_forensic_t;
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Benchmark Configuration (CB-STRUCT-001 §9)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -355,7 +514,13 @@ typedef struct {
     uint32_t warmup_iterations;     /**< Iterations before measurement (default: 100) */
     uint32_t measure_iterations;    /**< Iterations to measure (default: 1000) */
     uint32_t batch_size;            /**< Inference batch size (default: 1) */
-    uint32_t _padding1;
+    uint32_t timing_batch;          /**< Inference calls per timestamp pair
+                                         (default: 1; 0 treated as 1).
+                                         Values > 1 amortize timer overhead
+                                         for sub-microsecond kernels: each
+                                         recorded sample is the per-call
+                                         mean of timing_batch back-to-back
+                                         calls. */
 
     /* Timer configuration */
     cb_timer_source_t timer_source; /**< Preferred timer (default: CB_TIMER_AUTO) */
@@ -376,6 +541,58 @@ typedef struct {
     bool     monitor_environment;   /**< Collect thermal/frequency data (default: true) */
     uint8_t  _padding5[7];
 
+    /* Isolation (opt-in; applied at warmup start) */
+    bool     isolate;               /**< Enable isolation phase (default: false) */
+    bool     isolate_mlock;         /**< Lock + prefault buffers (default: true) */
+    bool     isolate_priority;      /**< Raise to SCHED_FIFO (best effort,
+                                         default: false) */
+    uint8_t  _padding6[1];
+    uint32_t isolate_core;          /**< CPU core to pin to (default: 0) */
+
+    /* Adaptive stopping (opt-in; CB-MATH-001 §6.9) */
+    bool     adaptive_stop;         /**< Stop once the CI target is met
+                                         (default: false) */
+    uint8_t  _padding7[3];
+    uint32_t ci_rel_q16;            /**< Target relative CI half-width of the
+                                         mean, Q16.16 (default: 655 ≈ 1%) */
+    uint32_t ci_check_interval;     /**< Samples between CI checks
+                                         (default: 256; 0 treated as 256) */
+    uint32_t ci_min_iterations;     /**< Never stop below this count
+                                         (default: 100) */
+
+    /* Adaptive warmup (opt-in; SRS-003-RUNNER §4.3) */
+    bool     adaptive_warmup;       /**< End warmup on steady state, with
+                                         warmup_iterations as the hard cap
+                                         (default: false) */
+    uint8_t  _padding8[3];
+    uint32_t warmup_window;         /**< Rolling-window size in iterations
+                                         (default: 16; 0 treated as 16) */
+    uint32_t warmup_drift_q16;      /**< Max relative drift between
+                                         consecutive window means, Q16.16
+                                         (default: 1311 ≈ 2%) */
+    uint32_t _padding9;
+
+    /* Cold-cache mode (opt-in; SRS-003-RUNNER §4.14) */
+    bool     cold_cache;            /**< Flush the working set before every
+                                         timed sample so measurements are
+                                         cold-start, not warm-path
+                                         (default: false) */
+    uint8_t  _padding10[7];
+    const void *cold_flush_base;    /**< Extra range flushed each iteration
+                                         (model weights, mapped data);
+                                         NULL = only the I/O buffers */
+    uint64_t cold_flush_size;       /**< Size of the extra range (0 = none) */
+
+    /* Outlier forensics (opt-in; SRS-003-RUNNER §4.15) */
+    uint64_t forensic_threshold_ns; /**< Capture context for samples at or
+                                         above this per-call latency
+                                         (0 = forensics off) */
+    cb_forensic_t *forensic_ring;   /**< Caller-provided record ring;
+                                         oldest records are overwritten
+                                         once full */
+    uint32_t forensic_capacity;     /**< Ring slots */
+    uint32_t _padding11;
+
     /* Paths (NULL = not used) */
     const char *model_path;         /**< Path to model bundle (.cbf) */
     const char *data_path;          /**< Path to test data */
@@ -410,7 +627,17 @@ typedef struct {
     uint32_t warmup_iterations;
     uint32_t measure_iterations;
     uint32_t batch_size;
-    uint32_t _padding2;
+    uint32_t timing_batch;               /**< Calls per timestamp pair; samples
+                                              are per-call means when > 1 */
+    bool cold_cache;                     /**< Measurement mode: true when the
+                                              working set was flushed before
+                                              every timed sample (§4.14) —
+                                              cold and warm results must
+                                              never be conflated */
+    bool streaming;                      /**< Throughput was measured over a
+                                              streamed corpus (§4.16), not
+                                              derived from summed latencies */
+    uint8_t _padding10[6];
 
     /*─────────────────────────────────────────────────────────────────────────
      * Timing Results (CB-MATH-001 §6)
@@ -430,6 +657,43 @@ typedef struct {
     bool env_stable;                     /**< cb_env_is_stable() result */
     uint8_t _padding3[7];
 
+    /*─────────────────────────────────────────────────────────────────────────
+     * Isolation State (SRS-003-RUNNER §4.9)
+     *─────────────────────────────────────────────────────────────────────────*/
+    bool isolation_active;               /**< Runner was pinned to a core */
+    bool isolation_mlock;                /**< Buffers locked and prefaulted */
+    bool isolation_priority;             /**< Real-time priority in effect */
+    uint8_t _padding7[1];
+    uint32_t isolation_core;             /**< Core pinned to (when active) */
+
+    /*─────────────────────────────────────────────────────────────────────────
+     * Adaptive Stopping (SRS-003-RUNNER §4.11)
+     *─────────────────────────────────────────────────────────────────────────*/
+    bool adaptive_stop;                  /**< Adaptive mode was enabled */
+    bool stopped_early;                  /**< CI target met before the cap */
+    uint8_t _padding8[2];
+    uint32_t ci_achieved_q16;            /**< Achieved relative CI half-width
+                                              of the mean, Q16.16 */
+    uint32_t warmup_consumed;            /**< Warmup iterations actually run
+                                              (< warmup_iterations when
+                                              adaptive warmup converged) */
+    uint32_t _padding9;
+
+    /*─────────────────────────────────────────────────────────────────────────
+     * Overhead Accounting (CB-MATH-001 §7.2, SRS-003-RUNNER §4.12)
+     *─────────────────────────────────────────────────────────────────────────*/
+    cb_overhead_t overhead;              /**< Per-phase harness wall time */
+
+    /*─────────────────────────────────────────────────────────────────────────
+     * Outlier Forensics (SRS-003-RUNNER §4.15)
+     *─────────────────────────────────────────────────────────────────────────*/
+    const cb_forensic_t *forensic_ring;  /**< Caller-provided ring (echo) */
+    uint32_t forensic_captured;          /**< Tail samples captured; may
+                                              exceed forensic_capacity, in
+                                              which case the ring holds the
+                                              most recent records */
+    uint32_t forensic_capacity;          /**< Ring slots */
+
     /*─────────────────────────────────────────────────────────────────────────
      * Histogram (optional, caller-provided buffer)
      *─────────────────────────────────────────────────────────────────────────*/
@@ -555,7 +819,19 @@ typedef struct {
     uint64_t benchmark_start_ns;         /**< Benchmark start time */
     bool initialised;                    /**< Runner has been initialised */
     bool warmup_complete;                /**< Warmup phase done */
-    uint8_t _padding[6];
+    bool isolation_active;               /**< Isolation phase applied */
+    bool isolation_mlock;                /**< Buffers locked and prefaulted */
+    bool isolation_priority;             /**< Real-time priority in effect */
+    bool stopped_early;                  /**< Adaptive stop fired (§4.11) */
+    bool throughput_measured;            /**< Streaming rates valid (§4.16) */
+    uint32_t isolation_core;             /**< Core pinned to (when active) */
+    uint32_t ci_achieved_q16;            /**< Achieved CI half-width (§4.11) */
+    uint32_t warmup_consumed;            /**< Warmup iterations run (§4.3) */
+    uint32_t forensic_captured;          /**< Tail samples captured (§4.15) */
+    cb_hwcounters_t forensic_base;       /**< Counters at previous capture */
+    cb_throughput_t measured_throughput; /**< Sustained streaming rates
+                                              (§4.16) */
+    cb_overhead_t overhead;              /**< Per-phase accounting (§4.12) */
     cb_fault_flags_t faults;             /**< Accumulated faults */
 } cb_runner_t;
 
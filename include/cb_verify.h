@@ -74,6 +74,40 @@ cb_result_code_t cb_verify_ctx_update(cb_verify_ctx_t *ctx,
  */
 cb_result_code_t cb_verify_ctx_final(cb_verify_ctx_t *ctx, cb_hash_t *hash);
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Hardware Acceleration Control (SRS-004-VERIFY §5.2)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Query whether a hardware SHA-256 path is active
+ *
+ * Returns true when the CPU provides SHA extensions (x86 SHA-NI or
+ * ARMv8 Crypto Extensions) and acceleration has not been disabled via
+ * cb_verify_set_accel(). Accelerated and scalar paths produce
+ * bit-identical FIPS 180-4 digests.
+ *
+ * @return true if hashing uses the hardware path
+ *
+ * @traceability SRS-004-VERIFY §5.2
+ */
+bool cb_verify_accel_available(void);
+
+/**
+ * @brief Enable or disable the hardware SHA-256 path
+ *
+ * Passing false forces the certified scalar implementation regardless
+ * of CPU capability — intended for certification runs and cross-path
+ * equivalence testing. Passing true re-detects CPU support.
+ *
+ * Not thread-safe with respect to in-flight hash computations; call
+ * before starting verification work.
+ *
+ * @param enable false to force scalar, true to allow hardware dispatch
+ *
+ * @traceability SRS-004-VERIFY §5.2
+ */
+void cb_verify_set_accel(bool enable);
+
 /*─────────────────────────────────────────────────────────────────────────────
  * One-Shot Hash API (SRS-004-VERIFY §4.6)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -94,6 +128,126 @@ cb_result_code_t cb_verify_ctx_final(cb_verify_ctx_t *ctx, cb_hash_t *hash);
  */
 cb_result_code_t cb_compute_hash(const void *data, uint32_t size, cb_hash_t *hash);
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Chunked Hash Tree (SRS-004-VERIFY §4.7, CB-MATH-001 §8.4)
+ *
+ * The streaming hash above chains every output through one SHA-256
+ * stream, which is inherently serial and localises a mismatch only to
+ * "somewhere in the run". The chunked tree hashes fixed-size chunks
+ * independently — parallelisable across cores — and binds them with a
+ * single root; comparing per-chunk hashes against a reference then
+ * identifies the first diverging chunk without a second run.
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/** Maximum worker threads for cb_hash_chunks_parallel() */
+#define CB_HASH_MAX_THREADS 32
+
+/**
+ * @brief Hash fixed-size chunks of a buffer independently
+ *
+ * Splits data into ceil(size / chunk_size) chunks (the last chunk may
+ * be short) and computes a standalone SHA-256 digest of each into the
+ * caller-provided array. Chunk digests depend only on their own bytes,
+ * so the same data always yields the same per-chunk hashes regardless
+ * of how the hashing work is scheduled.
+ *
+ * @param data         Buffer to hash
+ * @param size         Buffer size in bytes (must be > 0)
+ * @param chunk_size   Chunk size in bytes (must be > 0)
+ * @param chunk_hashes Caller-provided digest array
+ * @param capacity     Capacity of chunk_hashes in digests
+ * @param num_chunks   Receives the number of chunks hashed
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if data, chunk_hashes, or num_chunks is NULL
+ * @return CB_ERR_INVALID_CONFIG if size or chunk_size is 0
+ * @return CB_ERR_OUT_OF_MEMORY if capacity is too small
+ *
+ * @satisfies VERIFY-F-060, VERIFY-F-061
+ * @traceability SRS-004-VERIFY §4.7, CB-MATH-001 §8.4
+ */
+cb_result_code_t cb_hash_chunks(const void *data,
+                                uint64_t size,
+                                uint32_t chunk_size,
+                                cb_hash_t *chunk_hashes,
+                                uint32_t capacity,
+                                uint32_t *num_chunks);
+
+/**
+ * @brief Hash chunks in parallel across worker threads
+ *
+ * Identical digests to cb_hash_chunks() — chunk independence makes the
+ * result schedule-invariant — computed by num_threads workers over
+ * contiguous chunk ranges. num_threads is clamped to
+ * CB_HASH_MAX_THREADS and to the chunk count; 0 or 1 falls back to the
+ * serial path.
+ *
+ * @param data         Buffer to hash
+ * @param size         Buffer size in bytes (must be > 0)
+ * @param chunk_size   Chunk size in bytes (must be > 0)
+ * @param num_threads  Worker thread count (0/1 = serial)
+ * @param chunk_hashes Caller-provided digest array
+ * @param capacity     Capacity of chunk_hashes in digests
+ * @param num_chunks   Receives the number of chunks hashed
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if data, chunk_hashes, or num_chunks is NULL
+ * @return CB_ERR_INVALID_CONFIG if size or chunk_size is 0, or a
+ *         worker thread could not be created
+ * @return CB_ERR_OUT_OF_MEMORY if capacity is too small
+ *
+ * @satisfies VERIFY-F-062
+ * @traceability SRS-004-VERIFY §4.7
+ */
+cb_result_code_t cb_hash_chunks_parallel(const void *data,
+                                         uint64_t size,
+                                         uint32_t chunk_size,
+                                         uint32_t num_threads,
+                                         cb_hash_t *chunk_hashes,
+                                         uint32_t capacity,
+                                         uint32_t *num_chunks);
+
+/**
+ * @brief Combine chunk hashes into a single tree root
+ *
+ * Computes SHA256("CB:TREE:v1" || LE64(num_chunks) || h_0 || … ||
+ * h_{n-1}). Including the count in the preimage means a truncated
+ * chunk list cannot collide with a shorter valid one.
+ *
+ * @param chunk_hashes Chunk digest array
+ * @param num_chunks   Number of digests (must be > 0)
+ * @param root         Receives the root digest
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if chunk_hashes or root is NULL
+ * @return CB_ERR_INVALID_CONFIG if num_chunks is 0
+ *
+ * @satisfies VERIFY-F-063
+ * @traceability SRS-004-VERIFY §4.7, CB-MATH-001 §8.4
+ */
+cb_result_code_t cb_hash_tree_root(const cb_hash_t *chunk_hashes,
+                                   uint32_t num_chunks,
+                                   cb_hash_t *root);
+
+/**
+ * @brief Find the first diverging chunk between two hash arrays
+ *
+ * Compares the arrays digest-by-digest and reports the lowest index
+ * where they differ — the triage entry point after a root mismatch.
+ *
+ * @param a               First chunk digest array
+ * @param b               Second chunk digest array
+ * @param num_chunks      Number of digests to compare
+ * @param first_diverging Receives the first differing index, or
+ *                        UINT32_MAX when all digests match
+ * @return CB_OK on success
+ * @return CB_ERR_NULL_PTR if a, b, or first_diverging is NULL
+ *
+ * @satisfies VERIFY-F-064
+ * @traceability SRS-004-VERIFY §4.7
+ */
+cb_result_code_t cb_hash_chunks_diff(const cb_hash_t *a,
+                                     const cb_hash_t *b,
+                                     uint32_t num_chunks,
+                                     uint32_t *first_diverging);
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Hash Comparison (SRS-004-VERIFY §4.3)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -0,0 +1,201 @@
+/**
+ * @file data.c
+ * @brief Zero-copy data loading implementation
+ *
+ * Implements SRS-007-DATA: read-only memory mapping of model bundles
+ * and test corpora with optional prefault, content-hash verification,
+ * and bounds-checked slice views. The file contents live only in the
+ * kernel page cache — no user-space copy, no dynamic allocation.
+ *
+ * @traceability SRS-007-DATA, CB-STRUCT-001 §9
+ *
+ * Copyright © 2026 The Murray Family Innovation Trust. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#define _GNU_SOURCE  /* MAP_POPULATE, madvise */
+
+#include "cb_data.h"
+#include "cb_verify.h"
+
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Mapping Lifecycle (SRS-007-DATA §4.1)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Map a file read-only into the address space
+ * @satisfies DATA-F-001 through DATA-F-004
+ */
+cb_result_code_t cb_data_map(cb_data_map_t *map,
+                             const char *path,
+                             bool prefault)
+{
+    int fd;
+    struct stat st;
+    int flags;
+    void *base;
+
+    if (map == NULL || path == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    memset(map, 0, sizeof(*map));
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return CB_ERR_DATA_LOAD;
+    }
+
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return CB_ERR_DATA_LOAD;
+    }
+
+    flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    if (prefault) {
+        flags |= MAP_POPULATE;
+    }
+#endif
+
+    base = mmap(NULL, (size_t)st.st_size, PROT_READ, flags, fd, 0);
+
+    /* The mapping holds its own reference to the file */
+    close(fd);
+
+    if (base == MAP_FAILED) {
+        return CB_ERR_DATA_LOAD;
+    }
+
+#ifdef MADV_WILLNEED
+    if (prefault) {
+        /* Advisory only — a failed hint must not fail the map */
+        (void)madvise(base, (size_t)st.st_size, MADV_WILLNEED);
+    }
+#endif
+
+    map->base = base;
+    map->size = (uint64_t)st.st_size;
+    map->mapped = true;
+    map->prefaulted = prefault;
+    return CB_OK;
+}
+
+/**
+ * @brief Release a mapping
+ * @satisfies DATA-F-005
+ */
+cb_result_code_t cb_data_unmap(cb_data_map_t *map)
+{
+    if (map == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (!map->mapped) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* Casting away const is safe: the pages came from mmap, the const
+     * on base only guards callers against writing through slices */
+    (void)munmap((void *)(uintptr_t)map->base, (size_t)map->size);
+    memset(map, 0, sizeof(*map));
+    return CB_OK;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Content Verification (SRS-007-DATA §4.2)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/** Bytes per streaming hash update — keeps each update within the
+ *  32-bit size of cb_verify_ctx_update() for corpora beyond 4 GiB */
+#define DATA_HASH_BLOCK (1U << 20)
+
+/**
+ * @brief Verify the mapped content against an expected hash
+ * @satisfies DATA-F-010, DATA-F-011
+ */
+cb_result_code_t cb_data_verify(const cb_data_map_t *map,
+                                const cb_hash_t *expected)
+{
+    cb_verify_ctx_t ctx;
+    cb_hash_t computed;
+    const uint8_t *cursor;
+    uint64_t remaining;
+    uint32_t block;
+
+    if (map == NULL || expected == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (!map->mapped) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    cb_verify_ctx_init(&ctx);
+    cursor = (const uint8_t *)map->base;
+    remaining = map->size;
+    while (remaining > 0) {
+        block = (remaining < DATA_HASH_BLOCK) ? (uint32_t)remaining
+                                              : DATA_HASH_BLOCK;
+        cb_verify_ctx_update(&ctx, cursor, block);
+        cursor += block;
+        remaining -= block;
+    }
+    cb_verify_ctx_final(&ctx, &computed);
+
+    return cb_hash_equal(&computed, expected) ? CB_OK : CB_ERR_VERIFICATION;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Slice Views (SRS-007-DATA §4.3)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Number of fixed-size records the mapping holds
+ * @satisfies DATA-F-020
+ */
+uint64_t cb_data_num_records(const cb_data_map_t *map,
+                             uint32_t record_size)
+{
+    if (map == NULL || !map->mapped || record_size == 0) {
+        return 0;
+    }
+    return map->size / record_size;
+}
+
+/**
+ * @brief Bounds-checked view of one fixed-size record
+ * @satisfies DATA-F-021, DATA-F-022
+ */
+cb_result_code_t cb_data_slice(const cb_data_map_t *map,
+                               uint64_t index,
+                               uint32_t record_size,
+                               const void **slice)
+{
+    uint64_t offset;
+
+    if (map == NULL || slice == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (!map->mapped || record_size == 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* index × record_size cannot wrap: both bounds are checked against
+     * the 64-bit file size before forming the offset */
+    if (index >= map->size / record_size) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+    offset = index * record_size;
+    if (offset + record_size > map->size) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    *slice = (const void *)((const uint8_t *)map->base + offset);
+    return CB_OK;
+}
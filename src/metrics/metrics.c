@@ -13,6 +13,14 @@
 #include "cb_metrics.h"
 
 #include <string.h>
+#include <pthread.h>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 /*─────────────────────────────────────────────────────────────────────────────
  * Constants
@@ -21,6 +29,13 @@
 /** Threshold for switching from insertion sort to heapsort */
 #define SORT_THRESHOLD 64
 
+/** Threshold for switching from heapsort to LSD radix sort */
+#define RADIX_SORT_THRESHOLD 4096
+
+/** Radix sort digit width and bucket count */
+#define RADIX_BITS 8
+#define RADIX_BUCKETS 256
+
 /** Outlier threshold: 3.5 × 10000 = 35000 (scaled integer) */
 #define OUTLIER_THRESH_SCALED 35000
 
@@ -133,6 +148,69 @@ static void heapsort_u64(uint64_t *arr, uint32_t count)
     }
 }
 
+/**
+ * @brief LSD radix sort with caller-provided scratch buffer
+ *
+ * Eight passes over 8-bit digits, ping-ponging between arr and scratch.
+ * Passes where every element shares the same digit (the common case
+ * for nanosecond latencies, whose high bytes are zero) are skipped, so
+ * typical sample arrays need only three or four sequential passes.
+ * Stable, deterministic, O(n) — no comparisons and no pivot selection.
+ *
+ * @satisfies METRICS-NF-003
+ */
+void cb_sort_u64_radix(uint64_t *arr, uint64_t *scratch, uint32_t count)
+{
+    uint32_t counts[RADIX_BUCKETS];
+    uint64_t *src;
+    uint64_t *dst;
+    uint64_t *tmp;
+    uint32_t shift;
+    uint32_t i;
+
+    if (arr == NULL || scratch == NULL || count <= 1) {
+        return;
+    }
+
+    src = arr;
+    dst = scratch;
+
+    for (shift = 0; shift < 64; shift += RADIX_BITS) {
+        uint32_t first_digit = (uint32_t)((src[0] >> shift) & 0xFFU);
+        uint32_t total = 0;
+
+        memset(counts, 0, sizeof(counts));
+        for (i = 0; i < count; i++) {
+            counts[(uint32_t)((src[i] >> shift) & 0xFFU)]++;
+        }
+
+        /* All elements share this digit — the pass is a no-op */
+        if (counts[first_digit] == count) {
+            continue;
+        }
+
+        /* Exclusive prefix sums give each bucket its output offset */
+        for (i = 0; i < RADIX_BUCKETS; i++) {
+            uint32_t c = counts[i];
+            counts[i] = total;
+            total += c;
+        }
+
+        for (i = 0; i < count; i++) {
+            dst[counts[(uint32_t)((src[i] >> shift) & 0xFFU)]++] = src[i];
+        }
+
+        tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    /* Skipped passes can leave the sorted data in the scratch buffer */
+    if (src != arr) {
+        memcpy(arr, src, (size_t)count * sizeof(uint64_t));
+    }
+}
+
 /**
  * @satisfies METRICS-NF-003
  */
@@ -144,9 +222,26 @@ void cb_sort_u64(uint64_t *arr, uint32_t count)
 
     if (count <= SORT_THRESHOLD) {
         insertion_sort_u64(arr, count);
-    } else {
-        heapsort_u64(arr, count);
+        return;
     }
+
+    if (count > RADIX_SORT_THRESHOLD && count <= CB_MAX_SAMPLES) {
+        /* Static scratch avoids dynamic allocation (same pattern as
+         * cb_detect_outliers). Parallel workers may sort concurrently,
+         * so the scratch is claimed with a trylock — contenders fall
+         * back to heapsort, which needs no scratch. Output is identical
+         * either way. */
+        static uint64_t radix_scratch[CB_MAX_SAMPLES];
+        static pthread_mutex_t scratch_lock = PTHREAD_MUTEX_INITIALIZER;
+
+        if (pthread_mutex_trylock(&scratch_lock) == 0) {
+            cb_sort_u64_radix(arr, radix_scratch, count);
+            pthread_mutex_unlock(&scratch_lock);
+            return;
+        }
+    }
+
+    heapsort_u64(arr, count);
 }
 
 /*─────────────────────────────────────────────────────────────────────────────
@@ -208,6 +303,276 @@ uint64_t cb_percentile(const uint64_t *sorted_samples,
     return result;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Selection-Based Percentiles (CB-MATH-001 §6.4)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/** Maximum order statistics one multiselect call can target */
+#define SELECT_MAX_RANKS 8U
+
+/** Partition depth budget before falling back to heapsort */
+#define SELECT_DEPTH_LIMIT 48U
+
+/**
+ * @brief Swap two uint64_t values
+ */
+static void swap_u64(uint64_t *a, uint64_t *b)
+{
+    uint64_t tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+/**
+ * @brief Deterministic median-of-three pivot value
+ */
+static uint64_t median3_u64(uint64_t a, uint64_t b, uint64_t c)
+{
+    if (a < b) {
+        if (b < c) {
+            return b;
+        }
+        return (a < c) ? c : a;
+    }
+    if (a < c) {
+        return a;
+    }
+    return (b < c) ? c : b;
+}
+
+/**
+ * @brief Hoare partition around a deterministic median-of-three pivot
+ *
+ * On return every element in [lo, j] is <= every element in [j+1, hi].
+ * The pivot is the median of arr[lo], arr[mid], arr[hi], so at least one
+ * element at index < hi stops the forward scan and the returned split
+ * point is always strictly less than hi — progress is guaranteed.
+ *
+ * @param arr Array to partition
+ * @param lo  First index of the segment (inclusive)
+ * @param hi  Last index of the segment (inclusive)
+ * @return Split point j with lo <= j < hi
+ */
+static uint32_t partition_u64(uint64_t *arr, uint32_t lo, uint32_t hi)
+{
+    uint64_t pivot = median3_u64(arr[lo], arr[lo + (hi - lo) / 2U], arr[hi]);
+    uint32_t i = lo;
+    uint32_t j = hi;
+
+    for (;;) {
+        while (arr[i] < pivot) {
+            i++;
+        }
+        while (arr[j] > pivot) {
+            j--;
+        }
+        if (i >= j) {
+            return j;
+        }
+        swap_u64(&arr[i], &arr[j]);
+        i++;
+        j--;
+    }
+}
+
+/** One pending segment of the iterative multiselect */
+typedef struct {
+    uint32_t lo;          /**< First index of the segment (inclusive) */
+    uint32_t hi;          /**< Last index of the segment (inclusive) */
+    uint32_t rank_first;  /**< Index into ranks[] of first target inside */
+    uint32_t rank_last;   /**< Index into ranks[] of last target inside */
+    uint32_t depth;       /**< Partition rounds consumed so far */
+} select_segment_t;
+
+/**
+ * @brief Place each requested order statistic at its final position
+ *
+ * Iterative multiselect: each partition pass is shared between all
+ * target ranks, and only the sides still containing a target are
+ * revisited. Segments shorter than SORT_THRESHOLD are insertion-sorted;
+ * segments whose partition depth exceeds SELECT_DEPTH_LIMIT are
+ * heapsorted, bounding the worst case at O(n log n) on adversarial
+ * input. The pending-segment stack is bounded by the number of targets,
+ * so stack usage is fixed — no recursion.
+ *
+ * @param arr    Sample buffer (partially reordered in place)
+ * @param count  Number of elements (must be > 0)
+ * @param ranks  Target order statistics, sorted ascending, all < count
+ * @param nranks Number of targets (1 to SELECT_MAX_RANKS)
+ */
+static void multiselect_u64(uint64_t *arr, uint32_t count,
+                            const uint32_t *ranks, uint32_t nranks)
+{
+    select_segment_t stack[SELECT_MAX_RANKS];
+    uint32_t top;
+
+    stack[0].lo = 0;
+    stack[0].hi = count - 1U;
+    stack[0].rank_first = 0;
+    stack[0].rank_last = nranks - 1U;
+    stack[0].depth = 0;
+    top = 1;
+
+    while (top > 0) {
+        select_segment_t seg = stack[--top];
+
+        for (;;) {
+            uint32_t p;
+            uint32_t r;
+            bool left, right;
+
+            if (seg.hi - seg.lo < SORT_THRESHOLD) {
+                insertion_sort_u64(&arr[seg.lo], seg.hi - seg.lo + 1U);
+                break;
+            }
+            if (seg.depth >= SELECT_DEPTH_LIMIT) {
+                heapsort_u64(&arr[seg.lo], seg.hi - seg.lo + 1U);
+                break;
+            }
+
+            p = partition_u64(arr, seg.lo, seg.hi);
+
+            r = seg.rank_first;
+            while (r <= seg.rank_last && ranks[r] <= p) {
+                r++;
+            }
+            left = (r > seg.rank_first);
+            right = (r <= seg.rank_last);
+
+            seg.depth++;
+            if (left && right) {
+                /* Push the right side; continue with the left */
+                stack[top].lo = p + 1U;
+                stack[top].hi = seg.hi;
+                stack[top].rank_first = r;
+                stack[top].rank_last = seg.rank_last;
+                stack[top].depth = seg.depth;
+                top++;
+                seg.hi = p;
+                seg.rank_last = r - 1U;
+            } else if (left) {
+                seg.hi = p;
+            } else if (right) {
+                seg.lo = p + 1U;
+                seg.rank_first = r;
+            } else {
+                /* No targets inside — nothing left to place */
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Append a percentile's interpolation ranks to a target list
+ */
+static void select_add_ranks(uint32_t *ranks, uint32_t *nranks,
+                             uint32_t count, uint32_t percentile)
+{
+    uint32_t rank = (uint32_t)(((uint64_t)percentile * (count - 1U)) / 100U);
+    uint32_t i;
+
+    for (i = 0; i < 2U; i++) {
+        uint32_t candidate = rank + i;
+        uint32_t j;
+        bool present = false;
+
+        if (candidate >= count) {
+            break;
+        }
+        for (j = 0; j < *nranks; j++) {
+            if (ranks[j] == candidate) {
+                present = true;
+                break;
+            }
+        }
+        if (!present) {
+            ranks[*nranks] = candidate;
+            (*nranks)++;
+        }
+    }
+}
+
+/**
+ * @satisfies METRICS-F-030 through METRICS-F-036
+ */
+uint64_t cb_percentile_select(uint64_t *samples,
+                              uint32_t count,
+                              uint32_t percentile)
+{
+    uint32_t ranks[SELECT_MAX_RANKS];
+    uint32_t nranks = 0;
+
+    if (samples == NULL || count == 0) {
+        return 0;
+    }
+
+    if (percentile > 100) {
+        percentile = 100;
+    }
+
+    if (count == 1) {
+        return samples[0];
+    }
+
+    select_add_ranks(ranks, &nranks, count, percentile);
+    multiselect_u64(samples, count, ranks, nranks);
+
+    /* The interpolation ranks now hold their exact order statistics, and
+     * cb_percentile() reads only those two positions. */
+    return cb_percentile(samples, count, percentile);
+}
+
+/**
+ * @satisfies METRICS-F-030 through METRICS-F-036
+ */
+cb_result_code_t cb_percentile_select3(uint64_t *samples,
+                                       uint32_t count,
+                                       uint64_t *p50,
+                                       uint64_t *p95,
+                                       uint64_t *p99)
+{
+    uint32_t ranks[SELECT_MAX_RANKS];
+    uint32_t nranks = 0;
+    uint32_t i;
+
+    if (samples == NULL || p50 == NULL || p95 == NULL || p99 == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    if (count == 0) {
+        *p50 = 0;
+        *p95 = 0;
+        *p99 = 0;
+        return CB_OK;
+    }
+
+    if (count > 1) {
+        select_add_ranks(ranks, &nranks, count, 50);
+        select_add_ranks(ranks, &nranks, count, 95);
+        select_add_ranks(ranks, &nranks, count, 99);
+
+        /* Sort the (at most 6) target ranks ascending */
+        for (i = 1; i < nranks; i++) {
+            uint32_t key = ranks[i];
+            uint32_t j = i;
+            while (j > 0 && ranks[j - 1U] > key) {
+                ranks[j] = ranks[j - 1U];
+                j--;
+            }
+            ranks[j] = key;
+        }
+
+        multiselect_u64(samples, count, ranks, nranks);
+    }
+
+    *p50 = cb_percentile(samples, count, 50);
+    *p95 = cb_percentile(samples, count, 95);
+    *p99 = cb_percentile(samples, count, 99);
+
+    return CB_OK;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Basic Statistics (CB-MATH-001 §6.1, §6.2)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -338,6 +703,360 @@ cb_result_code_t cb_compute_stats(uint64_t *samples,
     return overflow_detected ? CB_ERR_OVERFLOW : CB_OK;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Streaming Statistics (CB-MATH-001 §6.7)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/** Desired-position scale for the P² estimator (keeps p/2 integral) */
+#define P2_SCALE 200
+
+/**
+ * @brief Initialise a P² quantile estimator for a target percentile
+ */
+static void p2_init(cb_quantile_est_t *est, uint32_t percentile)
+{
+    memset(est, 0, sizeof(*est));
+    est->percentile = percentile;
+}
+
+/**
+ * @brief Sorted insert used while the estimator is seeding (< 5 samples)
+ */
+static void p2_seed_insert(cb_quantile_est_t *est, int64_t x)
+{
+    uint32_t i = est->seeded;
+    while (i > 0 && est->q[i - 1] > x) {
+        est->q[i] = est->q[i - 1];
+        i--;
+    }
+    est->q[i] = x;
+    est->seeded++;
+
+    if (est->seeded == 5) {
+        int64_t p = (int64_t)est->percentile;
+        uint32_t j;
+        for (j = 0; j < 5; j++) {
+            est->n[j] = (int64_t)j + 1;
+        }
+        /* Desired positions {1, 1+2p, 1+4p, 3+2p, 5}, scaled ×200 */
+        est->d[0] = 1 * P2_SCALE;
+        est->d[1] = 1 * P2_SCALE + 4 * p;
+        est->d[2] = 1 * P2_SCALE + 8 * p;
+        est->d[3] = 3 * P2_SCALE + 4 * p;
+        est->d[4] = 5 * P2_SCALE;
+    }
+}
+
+/**
+ * @brief Feed one observation into a seeded P² estimator
+ *
+ * Integer adaptation of the P² parabolic marker update. Divisions
+ * truncate toward zero, which bounds the estimate within the adjacent
+ * marker heights (clamped by the linear fallback).
+ */
+static void p2_update(cb_quantile_est_t *est, int64_t x)
+{
+    int64_t p = (int64_t)est->percentile;
+    int32_t k, i;
+
+    if (est->seeded < 5) {
+        p2_seed_insert(est, x);
+        return;
+    }
+
+    /* Find the cell containing x, extending end markers if needed */
+    if (x < est->q[0]) {
+        est->q[0] = x;
+        k = 0;
+    } else if (x >= est->q[4]) {
+        est->q[4] = x;
+        k = 3;
+    } else {
+        k = 0;
+        while (k < 3 && x >= est->q[k + 1]) {
+            k++;
+        }
+    }
+
+    /* Shift actual positions above the cell */
+    for (i = k + 1; i < 5; i++) {
+        est->n[i]++;
+    }
+
+    /* Advance desired positions: increments {0, p/2, p, (1+p)/2, 1} ×200 */
+    est->d[1] += p;
+    est->d[2] += 2 * p;
+    est->d[3] += P2_SCALE / 2 + p;
+    est->d[4] += P2_SCALE;
+
+    /* Adjust interior markers toward their desired positions */
+    for (i = 1; i <= 3; i++) {
+        int64_t delta = est->d[i] - est->n[i] * P2_SCALE;
+        int64_t sign = 0;
+
+        if (delta >= P2_SCALE && est->n[i + 1] - est->n[i] > 1) {
+            sign = 1;
+        } else if (delta <= -P2_SCALE && est->n[i - 1] - est->n[i] < -1) {
+            sign = -1;
+        }
+
+        if (sign != 0) {
+            int64_t np = est->n[i + 1];
+            int64_t nm = est->n[i - 1];
+            int64_t nc = est->n[i];
+            int64_t qp = est->q[i + 1];
+            int64_t qm = est->q[i - 1];
+            int64_t qc = est->q[i];
+            int64_t qn;
+
+            /* Parabolic (piecewise-parabolic) prediction */
+            qn = qc + (sign * ((nc - nm + sign) * (qp - qc) / (np - nc) +
+                               (np - nc - sign) * (qc - qm) / (nc - nm)))
+                      / (np - nm);
+
+            /* Linear fallback if prediction leaves the bracket */
+            if (qn <= qm || qn >= qp) {
+                if (sign > 0) {
+                    qn = qc + (qp - qc) / (np - nc);
+                } else {
+                    qn = qc - (qm - qc) / (nm - nc);
+                }
+            }
+
+            est->q[i] = qn;
+            est->n[i] += sign;
+        }
+    }
+}
+
+/**
+ * @brief Read the current estimate from a P² estimator
+ */
+static uint64_t p2_result(const cb_quantile_est_t *est, uint64_t count)
+{
+    if (count == 0) {
+        return 0;
+    }
+
+    /* Still seeding: exact percentile over the sorted seed buffer */
+    if (est->seeded < 5) {
+        uint64_t sorted[5];
+        uint32_t i;
+        for (i = 0; i < est->seeded; i++) {
+            sorted[i] = (uint64_t)est->q[i];
+        }
+        return cb_percentile(sorted, est->seeded, est->percentile);
+    }
+
+    return (uint64_t)est->q[2];
+}
+
+cb_result_code_t cb_stats_stream_init(cb_stats_stream_t *stream)
+{
+    if (stream == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    memset(stream, 0, sizeof(*stream));
+    p2_init(&stream->p50, 50);
+    p2_init(&stream->p95, 95);
+    p2_init(&stream->p99, 99);
+    cb_fault_clear(&stream->faults);
+    return CB_OK;
+}
+
+cb_result_code_t cb_stats_stream_update(cb_stats_stream_t *stream,
+                                        uint64_t sample_ns)
+{
+    int64_t delta, delta2;
+
+    if (stream == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    if (stream->count == 0) {
+        stream->min_ns = sample_ns;
+        stream->max_ns = sample_ns;
+    } else {
+        if (sample_ns < stream->min_ns) stream->min_ns = sample_ns;
+        if (sample_ns > stream->max_ns) stream->max_ns = sample_ns;
+    }
+
+    /* Overflow-checked sum (CB-MATH-001 §5.2) */
+    if (would_overflow_add(stream->sum_ns, sample_ns)) {
+        stream->faults.overflow = 1;
+    } else {
+        stream->sum_ns += sample_ns;
+    }
+
+    stream->count++;
+
+    /* Integer Welford accumulation (matches cb_compute_stats) */
+    delta = (int64_t)sample_ns - stream->welford_m;
+    stream->welford_m += delta / (int64_t)stream->count;
+    delta2 = (int64_t)sample_ns - stream->welford_m;
+    stream->welford_s += delta * delta2;
+
+    p2_update(&stream->p50, (int64_t)sample_ns);
+    p2_update(&stream->p95, (int64_t)sample_ns);
+    p2_update(&stream->p99, (int64_t)sample_ns);
+
+    return CB_OK;
+}
+
+cb_result_code_t cb_stats_stream_final(const cb_stats_stream_t *stream,
+                                       cb_latency_stats_t *stats,
+                                       cb_fault_flags_t *faults)
+{
+    uint64_t variance, stddev;
+
+    if (stream == NULL || stats == NULL || faults == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+
+    if (stream->count == 0) {
+        faults->div_zero = 1;
+        return CB_ERR_OVERFLOW;
+    }
+
+    if (stream->faults.overflow) {
+        faults->overflow = 1;
+        stats->mean_ns = (uint64_t)stream->welford_m;
+    } else {
+        stats->mean_ns = stream->sum_ns / stream->count;
+    }
+
+    if (stream->count > 1) {
+        variance = (uint64_t)(stream->welford_s / (int64_t)(stream->count - 1));
+        stddev = cb_isqrt64(variance);
+    } else {
+        variance = 0;
+        stddev = 0;
+    }
+
+    stats->min_ns = stream->min_ns;
+    stats->max_ns = stream->max_ns;
+    stats->variance_ns2 = variance;
+    stats->stddev_ns = stddev;
+
+    /* sample_count saturates at UINT32_MAX for very long soaks */
+    stats->sample_count = (stream->count > UINT32_MAX)
+                              ? UINT32_MAX
+                              : (uint32_t)stream->count;
+
+    stats->median_ns = p2_result(&stream->p50, stream->count);
+    stats->p95_ns = p2_result(&stream->p95, stream->count);
+    stats->p99_ns = p2_result(&stream->p99, stream->count);
+
+    /* Streaming mode cannot revisit samples — no outlier counting */
+    stats->outlier_count = 0;
+
+    stats->wcet_observed_ns = stream->max_ns;
+    if (stddev <= (UINT64_MAX - stream->max_ns) / WCET_SIGMA) {
+        stats->wcet_bound_ns = stream->max_ns + WCET_SIGMA * stddev;
+    } else {
+        stats->wcet_bound_ns = stream->max_ns;
+        faults->overflow = 1;
+    }
+
+    return stream->faults.overflow ? CB_ERR_OVERFLOW : CB_OK;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Mergeable Statistics (CB-MATH-001 §6.8)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @traceability SRS-002-METRICS §4.7, CB-MATH-001 §6.8
+ */
+cb_result_code_t cb_stats_merge(const cb_latency_stats_t *parts,
+                                uint32_t num,
+                                cb_latency_stats_t *out,
+                                cb_fault_flags_t *faults)
+{
+    uint64_t total_count = 0;
+    uint64_t weighted_sum = 0;
+    int64_t pooled_s = 0;       /* Pooled sum of squared deviations */
+    uint64_t mean;
+    uint32_t i;
+
+    if (parts == NULL || out == NULL || faults == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    if (num == 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    memset(out, 0, sizeof(*out));
+
+    for (i = 0; i < num; i++) {
+        const cb_latency_stats_t *s = &parts[i];
+
+        if (i == 0 || s->min_ns < out->min_ns) out->min_ns = s->min_ns;
+        if (s->max_ns > out->max_ns) out->max_ns = s->max_ns;
+
+        /* Percentiles do not merge exactly from summaries — take the
+         * maximum across parts as a conservative upper bound */
+        if (s->median_ns > out->median_ns) out->median_ns = s->median_ns;
+        if (s->p95_ns > out->p95_ns) out->p95_ns = s->p95_ns;
+        if (s->p99_ns > out->p99_ns) out->p99_ns = s->p99_ns;
+
+        total_count += s->sample_count;
+        out->outlier_count += s->outlier_count;
+
+        /* Overflow-checked weighted sum for pooled mean */
+        if (s->mean_ns > 0 &&
+            (uint64_t)s->sample_count > UINT64_MAX / s->mean_ns) {
+            faults->overflow = 1;
+        } else {
+            uint64_t term = s->mean_ns * (uint64_t)s->sample_count;
+            if (weighted_sum > UINT64_MAX - term) {
+                faults->overflow = 1;
+            } else {
+                weighted_sum += term;
+            }
+        }
+    }
+
+    if (total_count == 0) {
+        faults->div_zero = 1;
+        return CB_ERR_OVERFLOW;
+    }
+
+    mean = weighted_sum / total_count;
+
+    /* Pooled variance: Σ((n_i - 1)·var_i + n_i·(mean_i - mean)²) / (N - 1) */
+    for (i = 0; i < num; i++) {
+        const cb_latency_stats_t *s = &parts[i];
+        int64_t dm = (int64_t)s->mean_ns - (int64_t)mean;
+        pooled_s += (int64_t)(s->sample_count > 0 ? s->sample_count - 1 : 0) *
+                    (int64_t)s->variance_ns2;
+        pooled_s += (int64_t)s->sample_count * dm * dm;
+    }
+
+    out->mean_ns = mean;
+    out->sample_count = (total_count > UINT32_MAX)
+                            ? UINT32_MAX
+                            : (uint32_t)total_count;
+    if (total_count > 1) {
+        out->variance_ns2 = (uint64_t)(pooled_s / (int64_t)(total_count - 1));
+        out->stddev_ns = cb_isqrt64(out->variance_ns2);
+    }
+
+    out->wcet_observed_ns = out->max_ns;
+    if (out->stddev_ns <= (UINT64_MAX - out->max_ns) / WCET_SIGMA) {
+        out->wcet_bound_ns = out->max_ns + WCET_SIGMA * out->stddev_ns;
+    } else {
+        out->wcet_bound_ns = out->max_ns;
+        faults->overflow = 1;
+    }
+
+    return CB_OK;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Histogram Construction
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -394,6 +1113,138 @@ cb_result_code_t cb_histogram_init(cb_histogram_t *histogram,
     return CB_OK;
 }
 
+/**
+ * @brief Initialise logarithmic-bucket histogram (HDR-style)
+ *
+ * Bins are laid out as unit-width buckets [0, S) followed by octaves of
+ * powers of two, each subdivided into S equal sub-buckets, up to the
+ * full uint64 nanosecond range. With S = 4 the full range fits in 252
+ * bins, so one configuration covers every latency profile without
+ * per-model range tuning. bin_width_ns is set to 0 as the variable-width
+ * sentinel recognised by cb_histogram_build().
+ *
+ * @traceability SRS-002-METRICS §4.4
+ */
+cb_result_code_t cb_histogram_init_log(cb_histogram_t *histogram,
+                                       cb_histogram_bin_t *bins,
+                                       uint32_t bins_capacity,
+                                       uint32_t subbuckets_per_octave)
+{
+    uint32_t log2_s = 0;
+    uint32_t required;
+    uint32_t octave;
+    uint32_t i, k;
+    uint32_t idx;
+
+    if (histogram == NULL || bins == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    /* Sub-bucket count must be a power of two in [2, 256] so octave
+     * subdivision stays exact in integer arithmetic */
+    if (subbuckets_per_octave < 2 || subbuckets_per_octave > 256 ||
+        (subbuckets_per_octave & (subbuckets_per_octave - 1)) != 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    while ((1U << log2_s) < subbuckets_per_octave) {
+        log2_s++;
+    }
+
+    /* Unit region + one S-bucket octave per power of two above it */
+    required = subbuckets_per_octave + (64 - log2_s) * subbuckets_per_octave;
+    if (bins_capacity < required) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* Unit-width buckets [0, 1), [1, 2), ... [S-1, S) */
+    idx = 0;
+    for (i = 0; i < subbuckets_per_octave; i++) {
+        bins[idx].min_ns = i;
+        bins[idx].max_ns = (uint64_t)i + 1;
+        bins[idx].count = 0;
+        bins[idx]._padding = 0;
+        idx++;
+    }
+
+    /* Octaves [2^o, 2^(o+1)) split into S sub-buckets of width 2^o / S */
+    for (octave = log2_s; octave < 64; octave++) {
+        uint64_t base = 1ULL << octave;
+        uint64_t width = base >> log2_s;
+
+        for (k = 0; k < subbuckets_per_octave; k++) {
+            bins[idx].min_ns = base + (uint64_t)k * width;
+            bins[idx].max_ns = bins[idx].min_ns + width;
+            bins[idx].count = 0;
+            bins[idx]._padding = 0;
+            idx++;
+        }
+    }
+
+    /* The top octave's arithmetic upper bound is 2^64 — clamp */
+    bins[idx - 1].max_ns = UINT64_MAX;
+
+    histogram->range_min_ns = 0;
+    histogram->range_max_ns = UINT64_MAX;
+    histogram->bin_width_ns = 0;  /* Variable-width sentinel */
+    histogram->num_bins = idx;
+    histogram->overflow_count = 0;
+    histogram->underflow_count = 0;
+    histogram->bins = bins;
+
+    return CB_OK;
+}
+
+/**
+ * @brief Locate the variable-width bin containing a sample
+ *
+ * Binary search for the first bin whose exclusive upper bound is above
+ * the sample. Bins are contiguous and ascending by construction, so
+ * that bin contains the sample. O(log num_bins), deterministic.
+ */
+static uint32_t histogram_find_bin(const cb_histogram_t *histogram,
+                                   uint64_t sample)
+{
+    uint32_t lo = 0;
+    uint32_t hi = histogram->num_bins;
+
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (histogram->bins[mid].max_ns <= sample) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * @brief High 64 bits of a 64×64-bit unsigned multiply
+ *
+ * Compiles to a single mulhi instruction where the compiler offers a
+ * 128-bit type; the 32-bit split keeps the function pure C99 elsewhere.
+ */
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 cb_u128_t;
+#endif
+
+static uint64_t mul_hi_u64(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+    return (uint64_t)(((cb_u128_t)a * b) >> 64);
+#else
+    uint64_t a_lo = a & 0xFFFFFFFFULL;
+    uint64_t a_hi = a >> 32;
+    uint64_t b_lo = b & 0xFFFFFFFFULL;
+    uint64_t b_hi = b >> 32;
+    uint64_t cross = (a_lo * b_lo >> 32) + (a_hi * b_lo & 0xFFFFFFFFULL)
+                     + a_lo * b_hi;
+    return a_hi * b_hi + (a_hi * b_lo >> 32) + (cross >> 32);
+#endif
+}
+
 /**
  * @satisfies METRICS-F-040 through METRICS-F-047
  */
@@ -403,6 +1254,7 @@ cb_result_code_t cb_histogram_build(const uint64_t *samples,
 {
     uint32_t i;
     uint32_t bin_idx;
+    uint64_t width, magic;
 
     if (samples == NULL || histogram == NULL || histogram->bins == NULL) {
         return CB_ERR_NULL_PTR;
@@ -415,6 +1267,15 @@ cb_result_code_t cb_histogram_build(const uint64_t *samples,
         histogram->bins[i].count = 0;
     }
 
+    /* Reciprocal for linear binning (METRICS-NF-020): the bin width is
+     * invariant across the build, so one division here replaces one per
+     * sample below. magic = floor((2^64 − 1) / width) underestimates
+     * the true quotient by at most 2; the fix-up loop restores the
+     * exact floor(offset / width), so bin counts are bit-identical to
+     * the division form. */
+    width = histogram->bin_width_ns;
+    magic = (width > 1) ? (UINT64_MAX / width) : 0;
+
     /* Bin each sample */
     for (i = 0; i < count; i++) {
         uint64_t sample = samples[i];
@@ -423,9 +1284,32 @@ cb_result_code_t cb_histogram_build(const uint64_t *samples,
             histogram->underflow_count++;
         } else if (sample >= histogram->range_max_ns) {
             histogram->overflow_count++;
+        } else if (width == 0) {
+            /* Variable-width (logarithmic) bins — binary search */
+            bin_idx = histogram_find_bin(histogram, sample);
+
+            if (bin_idx >= histogram->num_bins) {
+                bin_idx = histogram->num_bins - 1;
+            }
+
+            histogram->bins[bin_idx].count++;
         } else {
-            /* bin = (sample - min_ns) / bin_width */
-            bin_idx = (uint32_t)((sample - histogram->range_min_ns) / histogram->bin_width_ns);
+            /* bin = (sample - min_ns) / bin_width, by reciprocal
+             * multiply with exact fix-up */
+            uint64_t offset = sample - histogram->range_min_ns;
+            uint64_t q, r;
+
+            if (width == 1) {
+                q = offset;
+            } else {
+                q = mul_hi_u64(offset, magic);
+                r = offset - q * width;
+                while (r >= width) {
+                    q++;
+                    r -= width;
+                }
+            }
+            bin_idx = (uint32_t)q;
 
             /* Bounds check (should not be needed but defensive) */
             if (bin_idx >= histogram->num_bins) {
@@ -443,6 +1327,121 @@ cb_result_code_t cb_histogram_build(const uint64_t *samples,
  * Outlier Detection (CB-MATH-001 §6.5)
  *─────────────────────────────────────────────────────────────────────────────*/
 
+/**
+ * @brief Flag deviations at or above a precomputed cutoff (scalar)
+ *
+ * Certified reference path; the SIMD variants below must produce
+ * bit-identical flags and counts.
+ */
+static uint32_t flag_cutoff_scalar(const uint64_t *deviations,
+                                   uint32_t count,
+                                   uint64_t cutoff,
+                                   bool *outlier_flags)
+{
+    uint32_t i;
+    uint32_t num_outliers = 0;
+
+    for (i = 0; i < count; i++) {
+        if (deviations[i] >= cutoff) {
+            outlier_flags[i] = true;
+            num_outliers++;
+        } else {
+            outlier_flags[i] = false;
+        }
+    }
+
+    return num_outliers;
+}
+
+#if defined(__x86_64__)
+/**
+ * @brief AVX2 cutoff scan: four deviations per compare
+ *
+ * AVX2 has only a signed 64-bit compare, so both operands are biased
+ * by 2^63 — an order-preserving map from unsigned to signed — and
+ * dev ≥ cutoff is evaluated as biased(dev) > biased(cutoff − 1).
+ * cutoff ≥ 1 always holds here (mad ≥ 1 implies a positive cutoff).
+ */
+__attribute__((target("avx2")))
+static uint32_t flag_cutoff_avx2(const uint64_t *deviations,
+                                 uint32_t count,
+                                 uint64_t cutoff,
+                                 bool *outlier_flags)
+{
+    const __m256i bias = _mm256_set1_epi64x((long long)0x8000000000000000ULL);
+    const __m256i cut = _mm256_xor_si256(
+        _mm256_set1_epi64x((long long)(cutoff - 1U)), bias);
+    uint32_t i = 0;
+    uint32_t num_outliers = 0;
+
+    for (; i + 4U <= count; i += 4U) {
+        __m256i dev = _mm256_loadu_si256((const __m256i *)(const void *)
+                                         (deviations + i));
+        __m256i gt = _mm256_cmpgt_epi64(_mm256_xor_si256(dev, bias), cut);
+        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(gt));
+        int lane;
+
+        for (lane = 0; lane < 4; lane++) {
+            outlier_flags[i + (uint32_t)lane] = ((mask >> lane) & 1) != 0;
+        }
+        num_outliers += (uint32_t)__builtin_popcount((unsigned)mask);
+    }
+
+    num_outliers += flag_cutoff_scalar(deviations + i, count - i,
+                                       cutoff, outlier_flags + i);
+    return num_outliers;
+}
+#endif /* __x86_64__ */
+
+#if defined(__aarch64__)
+/**
+ * @brief NEON cutoff scan: two deviations per compare
+ */
+static uint32_t flag_cutoff_neon(const uint64_t *deviations,
+                                 uint32_t count,
+                                 uint64_t cutoff,
+                                 bool *outlier_flags)
+{
+    const uint64x2_t cut = vdupq_n_u64(cutoff);
+    uint32_t i = 0;
+    uint32_t num_outliers = 0;
+
+    for (; i + 2U <= count; i += 2U) {
+        uint64x2_t dev = vld1q_u64(deviations + i);
+        uint64x2_t ge = vcgeq_u64(dev, cut);
+        uint64_t lo = vgetq_lane_u64(ge, 0);
+        uint64_t hi = vgetq_lane_u64(ge, 1);
+
+        outlier_flags[i] = (lo != 0);
+        outlier_flags[i + 1U] = (hi != 0);
+        num_outliers += (lo != 0) ? 1U : 0U;
+        num_outliers += (hi != 0) ? 1U : 0U;
+    }
+
+    num_outliers += flag_cutoff_scalar(deviations + i, count - i,
+                                       cutoff, outlier_flags + i);
+    return num_outliers;
+}
+#endif /* __aarch64__ */
+
+/**
+ * @brief Runtime-dispatched cutoff scan (METRICS-NF-021)
+ */
+static uint32_t flag_cutoff(const uint64_t *deviations,
+                            uint32_t count,
+                            uint64_t cutoff,
+                            bool *outlier_flags)
+{
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("avx2")) {
+        return flag_cutoff_avx2(deviations, count, cutoff, outlier_flags);
+    }
+#elif defined(__aarch64__)
+    return flag_cutoff_neon(deviations, count, cutoff, outlier_flags);
+#endif
+    return flag_cutoff_scalar(deviations, count, cutoff, outlier_flags);
+}
+
 /**
  * @satisfies METRICS-F-050 through METRICS-F-056
  */
@@ -451,10 +1450,9 @@ cb_result_code_t cb_detect_outliers(const uint64_t *samples,
                                     bool *outlier_flags,
                                     uint32_t *outlier_count)
 {
-    uint64_t *sorted_copy = NULL;
+    uint64_t *scratch = NULL;
     uint64_t *deviations = NULL;
     uint64_t median, mad;
-    uint64_t modified_z_scaled;
     uint32_t i;
     uint32_t num_outliers = 0;
 
@@ -476,17 +1474,20 @@ cb_result_code_t cb_detect_outliers(const uint64_t *samples,
     }
 
     /* Use static buffers */
-    sorted_copy = static_buf1;
+    scratch = static_buf1;
     deviations = static_buf2;
 
     /* Copy and sort for median */
-    memcpy(sorted_copy, samples, count * sizeof(uint64_t));
-    cb_sort_u64(sorted_copy, count);
+    memcpy(scratch, samples, count * sizeof(uint64_t));
+    cb_sort_u64(scratch, count);
 
     /* Compute median */
-    median = cb_percentile(sorted_copy, count, 50);
+    median = cb_percentile(scratch, count, 50);
 
-    /* Compute absolute deviations from median */
+    /* Single deviation pass (METRICS-NF-021): absolute deviations are
+     * computed once, in sample order, then a sorted copy yields the
+     * MAD — the flagging pass below reuses the ordered array instead
+     * of recomputing every deviation */
     for (i = 0; i < count; i++) {
         if (samples[i] >= median) {
             deviations[i] = samples[i] - median;
@@ -495,9 +1496,10 @@ cb_result_code_t cb_detect_outliers(const uint64_t *samples,
         }
     }
 
-    /* Sort deviations and compute MAD (median of deviations) */
-    cb_sort_u64(deviations, count);
-    mad = cb_percentile(deviations, count, 50);
+    /* MAD = median of deviations (scratch is free after the median) */
+    memcpy(scratch, deviations, count * sizeof(uint64_t));
+    cb_sort_u64(scratch, count);
+    mad = cb_percentile(scratch, count, 50);
 
     /* If MAD = 0, no outliers (all samples identical or nearly so) */
     if (mad == 0) {
@@ -508,29 +1510,38 @@ cb_result_code_t cb_detect_outliers(const uint64_t *samples,
         return CB_OK;
     }
 
-    /* Flag outliers using modified Z-score */
-    for (i = 0; i < count; i++) {
-        uint64_t deviation;
-
-        if (samples[i] >= median) {
-            deviation = samples[i] - median;
-        } else {
-            deviation = median - samples[i];
-        }
-
-        /*
-         * Modified Z-score (scaled by 10000):
-         * modified_z_scaled = (6745 × deviation) / MAD
-         *
-         * Outlier if modified_z_scaled > 35000 (i.e., |z| > 3.5)
-         */
-        modified_z_scaled = (MAD_SCALE_FACTOR * deviation) / mad;
+    /*
+     * Modified Z-score (scaled by 10000):
+     * modified_z_scaled = (6745 × deviation) / MAD
+     *
+     * Outlier if modified_z_scaled > 35000 (i.e., |z| > 3.5). The
+     * per-sample divide is folded into a single cutoff:
+     *
+     *   (6745·dev)/mad > 35000  ⟺  6745·dev ≥ 35001·mad
+     *                           ⟺  dev ≥ ceil(35001·mad / 6745)
+     *
+     * which turns flagging into one unsigned compare per sample —
+     * vectorisable, and exactly equivalent in integer arithmetic.
+     */
+    if (mad <= (UINT64_MAX - (MAD_SCALE_FACTOR - 1)) /
+                   (OUTLIER_THRESH_SCALED + 1)) {
+        uint64_t cutoff = ((OUTLIER_THRESH_SCALED + 1) * mad +
+                           (MAD_SCALE_FACTOR - 1)) / MAD_SCALE_FACTOR;
 
-        if (modified_z_scaled > OUTLIER_THRESH_SCALED) {
-            outlier_flags[i] = true;
-            num_outliers++;
-        } else {
-            outlier_flags[i] = false;
+        num_outliers = flag_cutoff(deviations, count, cutoff, outlier_flags);
+    } else {
+        /* A MAD this wide could wrap the cutoff product — keep the
+         * division form for these degenerate inputs */
+        for (i = 0; i < count; i++) {
+            uint64_t modified_z_scaled =
+                (MAD_SCALE_FACTOR * deviations[i]) / mad;
+
+            if (modified_z_scaled > OUTLIER_THRESH_SCALED) {
+                outlier_flags[i] = true;
+                num_outliers++;
+            } else {
+                outlier_flags[i] = false;
+            }
         }
     }
 
@@ -21,10 +21,15 @@
 #include <string.h>
 #include <errno.h>
 
+#include <pthread.h>
+#include <time.h>
+
 #ifdef __linux__
 #include <unistd.h>
+#include <fcntl.h>
 #include <sys/syscall.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
 #include <linux/perf_event.h>
 #endif
 
@@ -56,8 +61,12 @@ static const char *THROTTLE_PATH = "/sys/devices/system/cpu/cpu0/thermal_throttl
 static bool g_platform_initialized = false;
 
 #ifdef __linux__
-/** File descriptors for perf_event counters */
+/** File descriptors for perf_event counters — [0] is the group leader */
 static int g_perf_fds[NUM_HW_COUNTERS] = {-1, -1, -1, -1, -1, -1};
+
+/** mmap'd perf counter pages for the rdpmc fast path (NULL = no page) */
+static void *g_perf_pages[NUM_HW_COUNTERS] = {NULL, NULL, NULL, NULL, NULL, NULL};
+
 static bool g_hwcounters_started = false;
 static bool g_hwcounters_available = false;
 #endif
@@ -260,14 +269,43 @@ static int perf_event_open(struct perf_event_attr *attr, pid_t pid,
 }
 
 /**
- * @brief Try to open hardware counters
+ * @brief Close all counter fds and unmap their pages
+ */
+static void close_hwcounters(void)
+{
+    int i;
+    long page_size = sysconf(_SC_PAGESIZE);
+
+    for (i = 0; i < NUM_HW_COUNTERS; i++) {
+        if (g_perf_pages[i] != NULL) {
+            munmap(g_perf_pages[i], (size_t)page_size);
+            g_perf_pages[i] = NULL;
+        }
+        if (g_perf_fds[i] >= 0) {
+            close(g_perf_fds[i]);
+            g_perf_fds[i] = -1;
+        }
+    }
+}
+
+/**
+ * @brief Try to open hardware counters as one perf group
+ *
+ * The cycles counter is the group leader; the other five join its
+ * group, so the kernel schedules all six onto the PMU together and a
+ * single PERF_FORMAT_GROUP read returns one consistent snapshot —
+ * no cross-counter multiplexing skew, one syscall instead of six.
+ *
+ * Each fd's perf page is also mmap'd where permitted, enabling the
+ * userspace rdpmc read path in cb_hwcounters_read().
  */
 static bool try_open_hwcounters(void)
 {
     struct perf_event_attr pe;
+    long page_size = sysconf(_SC_PAGESIZE);
     int i;
 
-    /* Counter configurations */
+    /* Counter configurations — index 0 is the group leader */
     static const struct {
         uint32_t type;
         uint64_t config;
@@ -281,38 +319,179 @@ static bool try_open_hwcounters(void)
     };
 
     /* Close any existing counters */
-    for (i = 0; i < NUM_HW_COUNTERS; i++) {
-        if (g_perf_fds[i] >= 0) {
-            close(g_perf_fds[i]);
-            g_perf_fds[i] = -1;
-        }
-    }
+    close_hwcounters();
 
-    /* Open each counter */
     for (i = 0; i < NUM_HW_COUNTERS; i++) {
         memset(&pe, 0, sizeof(pe));
         pe.type = counter_configs[i].type;
         pe.config = counter_configs[i].config;
         pe.size = sizeof(pe);
-        pe.disabled = 1;
         pe.exclude_kernel = 1;
         pe.exclude_hv = 1;
 
-        g_perf_fds[i] = perf_event_open(&pe, 0, -1, -1, 0);
+        if (i == 0) {
+            /* Leader: starts disabled, owns the group read format */
+            pe.disabled = 1;
+            pe.read_format = PERF_FORMAT_GROUP;
+            g_perf_fds[i] = perf_event_open(&pe, 0, -1, -1, 0);
+        } else {
+            /* Members follow the leader's enable/disable state */
+            pe.disabled = 0;
+            g_perf_fds[i] = perf_event_open(&pe, 0, -1, g_perf_fds[0], 0);
+        }
 
         if (g_perf_fds[i] < 0) {
-            /* Clean up and return failure */
-            int j;
-            for (j = 0; j < i; j++) {
-                close(g_perf_fds[j]);
-                g_perf_fds[j] = -1;
-            }
+            close_hwcounters();
             return false;
         }
+
+        /* Fast-path page: optional — read falls back to the group
+         * syscall when any page is missing */
+        g_perf_pages[i] = mmap(NULL, (size_t)page_size, PROT_READ,
+                               MAP_SHARED, g_perf_fds[i], 0);
+        if (g_perf_pages[i] == MAP_FAILED) {
+            g_perf_pages[i] = NULL;
+        }
     }
 
     return true;
 }
+
+/**
+ * @brief Read all six counters with one group-read syscall
+ *
+ * @param values Output array of NUM_HW_COUNTERS raw counts
+ * @return true if the full group snapshot was read
+ */
+static bool read_group_syscall(uint64_t *values)
+{
+    /* PERF_FORMAT_GROUP layout: { u64 nr; u64 values[nr]; } */
+    uint64_t buf[1 + NUM_HW_COUNTERS];
+    ssize_t ret;
+    int i;
+
+    ret = read(g_perf_fds[0], buf, sizeof(buf));
+    if (ret != (ssize_t)sizeof(buf) || buf[0] != NUM_HW_COUNTERS) {
+        return false;
+    }
+
+    for (i = 0; i < NUM_HW_COUNTERS; i++) {
+        values[i] = buf[1 + i];
+    }
+    return true;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+/**
+ * @brief Read one performance-monitoring counter register
+ */
+static uint64_t rdpmc_read(uint32_t counter)
+{
+    uint32_t lo, hi;
+    __asm__ volatile("rdpmc" : "=a"(lo), "=d"(hi) : "c"(counter));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+/**
+ * @brief Read one counter through its mmap'd perf page
+ *
+ * Seqlock protocol from the perf_event_mmap_page ABI: read the lock,
+ * the PMC index and the kernel-maintained offset, add the live rdpmc
+ * value (sign-extended to pmc_width), and retry if the kernel moved
+ * the counter mid-read. No syscall on the happy path.
+ *
+ * @param page Counter's mmap'd perf page
+ * @param value Output raw count
+ * @return true if the userspace read path is permitted for this counter
+ */
+static bool mmap_read_counter(void *page, uint64_t *value)
+{
+    volatile struct perf_event_mmap_page *pc =
+        (volatile struct perf_event_mmap_page *)page;
+    uint32_t seq, idx;
+    uint64_t count, pmc;
+    uint16_t width;
+
+    do {
+        seq = pc->lock;
+        __asm__ volatile("" ::: "memory");
+
+        if (!pc->cap_user_rdpmc || pc->index == 0) {
+            return false;  /* Kernel forbids rdpmc or event not scheduled */
+        }
+        idx = pc->index;
+        count = (uint64_t)pc->offset;
+        width = pc->pmc_width;
+
+        pmc = rdpmc_read(idx - 1U);
+        /* Sign-extend from pmc_width to 64 bits */
+        pmc <<= 64 - width;
+        pmc = (uint64_t)((int64_t)pmc >> (64 - width));
+        count += pmc;
+
+        __asm__ volatile("" ::: "memory");
+    } while (pc->lock != seq);
+
+    *value = count;
+    return true;
+}
+
+#endif /* x86 rdpmc path */
+
+/**
+ * @brief Read all counters, preferring the userspace fast path
+ *
+ * @param values Output array of NUM_HW_COUNTERS raw counts
+ * @return true on success
+ */
+static bool read_group(uint64_t *values)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    int i;
+    bool fast = true;
+
+    for (i = 0; i < NUM_HW_COUNTERS; i++) {
+        if (g_perf_pages[i] == NULL ||
+            !mmap_read_counter(g_perf_pages[i], &values[i])) {
+            fast = false;
+            break;
+        }
+    }
+    if (fast) {
+        return true;
+    }
+#endif
+    return read_group_syscall(values);
+}
+
+/**
+ * @brief Populate the output structure from raw counts
+ */
+static void fill_hwcounters(const uint64_t *values, cb_hwcounters_t *counters)
+{
+    counters->available = true;
+    counters->cycles = values[0];
+    counters->instructions = values[1];
+    counters->cache_refs = values[2];
+    counters->cache_misses = values[3];
+    counters->branch_refs = values[4];
+    counters->branch_misses = values[5];
+
+    /* Compute IPC in Q16.16 (PLATFORM-F-024) */
+    if (counters->cycles > 0) {
+        counters->ipc_q16 = (uint32_t)((counters->instructions << 16) / counters->cycles);
+    } else {
+        counters->ipc_q16 = 0;
+    }
+
+    /* Compute cache miss rate in Q16.16 (PLATFORM-F-025) */
+    if (counters->cache_refs > 0) {
+        counters->cache_miss_rate_q16 = (uint32_t)((counters->cache_misses << 16) / counters->cache_refs);
+    } else {
+        counters->cache_miss_rate_q16 = 0;
+    }
+}
 #endif
 
 /**
@@ -333,8 +512,6 @@ bool cb_hwcounters_available(void)
 cb_result_code_t cb_hwcounters_start(void)
 {
 #ifdef __linux__
-    int i;
-
     if (!g_hwcounters_available) {
         return CB_ERR_HWCOUNTERS;
     }
@@ -343,13 +520,9 @@ cb_result_code_t cb_hwcounters_start(void)
         return CB_ERR_HWCOUNTERS;  /* Already started */
     }
 
-    /* Reset and enable all counters */
-    for (i = 0; i < NUM_HW_COUNTERS; i++) {
-        if (g_perf_fds[i] >= 0) {
-            ioctl(g_perf_fds[i], PERF_EVENT_IOC_RESET, 0);
-            ioctl(g_perf_fds[i], PERF_EVENT_IOC_ENABLE, 0);
-        }
-    }
+    /* Reset and enable the whole group through the leader */
+    ioctl(g_perf_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(g_perf_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
 
     g_hwcounters_started = true;
     return CB_OK;
@@ -361,17 +534,15 @@ cb_result_code_t cb_hwcounters_start(void)
 /**
  * @satisfies PLATFORM-F-022 through PLATFORM-F-026
  */
-cb_result_code_t cb_hwcounters_stop(cb_hwcounters_t *counters)
+cb_result_code_t cb_hwcounters_read(cb_hwcounters_t *counters)
 {
     if (counters == NULL) {
         return CB_ERR_NULL_PTR;
     }
 
-    /* Clear output */
     memset(counters, 0, sizeof(*counters));
 
 #ifdef __linux__
-    int i;
     uint64_t values[NUM_HW_COUNTERS] = {0};
 
     if (!g_hwcounters_started) {
@@ -379,43 +550,79 @@ cb_result_code_t cb_hwcounters_stop(cb_hwcounters_t *counters)
         return CB_ERR_HWCOUNTERS;
     }
 
-    /* Disable and read all counters */
-    for (i = 0; i < NUM_HW_COUNTERS; i++) {
-        if (g_perf_fds[i] >= 0) {
-            ioctl(g_perf_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+    if (!read_group(values)) {
+        counters->available = false;
+        return CB_ERR_HWCOUNTERS;
+    }
 
-            ssize_t ret = read(g_perf_fds[i], &values[i], sizeof(uint64_t));
-            if (ret != sizeof(uint64_t)) {
-                values[i] = 0;
-            }
+    fill_hwcounters(values, counters);
+    return CB_OK;
+#else
+    counters->available = false;
+    return CB_ERR_HWCOUNTERS;
+#endif
+}
+
+/**
+ * @satisfies PLATFORM-F-020
+ */
+bool cb_hwcounters_fast_available(void)
+{
+#if defined(__linux__) && (defined(__x86_64__) || defined(__i386__))
+    int i;
+
+    if (!g_hwcounters_available) {
+        return false;
+    }
+    for (i = 0; i < NUM_HW_COUNTERS; i++) {
+        if (g_perf_pages[i] == NULL) {
+            return false;
         }
     }
+    /* cap_user_rdpmc is only meaningful while the event is scheduled,
+     * so the definitive check happens per read — this reports whether
+     * the pages needed for the fast path exist */
+    return true;
+#else
+    return false;
+#endif
+}
 
-    g_hwcounters_started = false;
+/**
+ * @satisfies PLATFORM-F-022 through PLATFORM-F-026
+ */
+cb_result_code_t cb_hwcounters_stop(cb_hwcounters_t *counters)
+{
+    if (counters == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
 
-    /* Populate output structure */
-    counters->available = true;
-    counters->cycles = values[0];
-    counters->instructions = values[1];
-    counters->cache_refs = values[2];
-    counters->cache_misses = values[3];
-    counters->branch_refs = values[4];
-    counters->branch_misses = values[5];
+    /* Clear output */
+    memset(counters, 0, sizeof(*counters));
 
-    /* Compute IPC in Q16.16 (PLATFORM-F-024) */
-    if (counters->cycles > 0) {
-        counters->ipc_q16 = (uint32_t)((counters->instructions << 16) / counters->cycles);
-    } else {
-        counters->ipc_q16 = 0;
+#ifdef __linux__
+    uint64_t values[NUM_HW_COUNTERS] = {0};
+    bool ok;
+
+    if (!g_hwcounters_started) {
+        counters->available = false;
+        return CB_ERR_HWCOUNTERS;
     }
 
-    /* Compute cache miss rate in Q16.16 (PLATFORM-F-025) */
-    if (counters->cache_refs > 0) {
-        counters->cache_miss_rate_q16 = (uint32_t)((counters->cache_misses << 16) / counters->cache_refs);
-    } else {
-        counters->cache_miss_rate_q16 = 0;
+    /* Disable the whole group atomically through the leader, then read
+     * all six values in one pass — no inter-counter skew from per-fd
+     * stop/read sequencing */
+    ioctl(g_perf_fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    ok = read_group(values);
+
+    g_hwcounters_started = false;
+
+    if (!ok) {
+        counters->available = false;
+        return CB_ERR_HWCOUNTERS;
     }
 
+    fill_hwcounters(values, counters);
     return CB_OK;
 #else
     counters->available = false;
@@ -572,6 +779,334 @@ bool cb_env_check_stable(const cb_env_stats_t *stats)
     return true;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Persistent Environmental Monitor (SRS-006-PLATFORM §4.7)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Read a single integer from an already-open sysfs descriptor
+ *
+ * Uses pread at offset 0 so the descriptor never needs reopening or
+ * rewinding — one syscall per read, no allocation.
+ *
+ * @param fd Open descriptor, or -1 if the source is absent
+ * @param value Output value
+ * @return true on success
+ */
+static bool pread_sysfs_int(int fd, int64_t *value)
+{
+#ifdef __linux__
+    char buf[MAX_LINE_LEN];
+    ssize_t n;
+
+    if (fd < 0) {
+        return false;
+    }
+
+    n = pread(fd, buf, sizeof(buf) - 1U, 0);
+    if (n <= 0) {
+        return false;
+    }
+
+    buf[n] = '\0';
+    *value = strtoll(buf, NULL, 10);
+    return true;
+#else
+    (void)fd;
+    (void)value;
+    return false;
+#endif
+}
+
+/**
+ * @brief Take one sample into the monitor's ring and update extrema
+ *
+ * Ring slot is sample_count mod capacity; the running extrema and
+ * first/last copies make the statistics exact even after the ring
+ * wraps (PLATFORM-F-074).
+ *
+ * @param monitor Active monitor
+ */
+static void monitor_sample(cb_env_monitor_t *monitor)
+{
+    cb_env_snapshot_t snap;
+    int64_t value;
+    uint32_t slot;
+
+    snap.timestamp_ns = cb_timer_now_ns();
+    snap.cpu_freq_hz = 0;
+    snap.cpu_temp_mC = 0;
+    snap.throttle_count = 0;
+
+    if (pread_sysfs_int(monitor->fd_freq, &value)) {
+        snap.cpu_freq_hz = (uint64_t)value * 1000;  /* kHz to Hz */
+    }
+    if (pread_sysfs_int(monitor->fd_temp, &value)) {
+        snap.cpu_temp_mC = (int32_t)value;
+    }
+    if (pread_sysfs_int(monitor->fd_throttle, &value)) {
+        snap.throttle_count = (uint32_t)value;
+    }
+
+    slot = monitor->sample_count % monitor->ring_capacity;
+    monitor->ring[slot] = snap;
+
+    if (monitor->sample_count == 0) {
+        monitor->first = snap;
+    }
+    monitor->last = snap;
+
+    /* Running extrema — zero reads mean "no data" and are excluded */
+    if (snap.cpu_freq_hz > 0) {
+        if (!monitor->have_freq || snap.cpu_freq_hz < monitor->min_freq_hz) {
+            monitor->min_freq_hz = snap.cpu_freq_hz;
+        }
+        if (!monitor->have_freq || snap.cpu_freq_hz > monitor->max_freq_hz) {
+            monitor->max_freq_hz = snap.cpu_freq_hz;
+        }
+        monitor->have_freq = true;
+    }
+    if (snap.cpu_temp_mC != 0) {
+        if (!monitor->have_temp || snap.cpu_temp_mC < monitor->min_temp_mC) {
+            monitor->min_temp_mC = snap.cpu_temp_mC;
+        }
+        if (!monitor->have_temp || snap.cpu_temp_mC > monitor->max_temp_mC) {
+            monitor->max_temp_mC = snap.cpu_temp_mC;
+        }
+        monitor->have_temp = true;
+    }
+
+    monitor->sample_count++;
+}
+
+/**
+ * @brief Background sampler thread entry point
+ *
+ * Samples at the configured period until stop is requested. Runs
+ * entirely off the measurement thread; its only shared state is the
+ * monitor itself, which the owner touches again only after join.
+ *
+ * @param arg Monitor (cb_env_monitor_t *)
+ * @return NULL
+ */
+static void *monitor_thread_main(void *arg)
+{
+    cb_env_monitor_t *monitor = (cb_env_monitor_t *)arg;
+    struct timespec period;
+
+    period.tv_sec = (time_t)(monitor->period_ms / 1000U);
+    period.tv_nsec = (long)((monitor->period_ms % 1000U) * CB_NS_PER_MS);
+
+    while (!monitor->stop_requested) {
+        monitor_sample(monitor);
+        nanosleep(&period, NULL);
+    }
+
+    return NULL;
+}
+
+/**
+ * @satisfies PLATFORM-F-070, PLATFORM-F-071
+ */
+cb_result_code_t cb_env_monitor_init(cb_env_monitor_t *monitor,
+                                     cb_env_snapshot_t *ring,
+                                     uint32_t ring_capacity,
+                                     uint32_t period_ms)
+{
+    if (monitor == NULL || ring == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    if (ring_capacity == 0 || period_ms == 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    memset(monitor, 0, sizeof(*monitor));
+    monitor->ring = ring;
+    monitor->ring_capacity = ring_capacity;
+    monitor->period_ms = period_ms;
+    monitor->fd_freq = -1;
+    monitor->fd_temp = -1;
+    monitor->fd_throttle = -1;
+
+#ifdef __linux__
+    /* Open the sources once — absent files degrade to zero fields */
+    monitor->fd_freq = open(CPU_FREQ_PATH, O_RDONLY);
+    monitor->fd_temp = open(CPU_TEMP_PATH, O_RDONLY);
+    monitor->fd_throttle = open(THROTTLE_PATH, O_RDONLY);
+#endif
+
+    /* Immediate first sample so stats exist even for very short runs */
+    monitor_sample(monitor);
+
+    return CB_OK;
+}
+
+/**
+ * @satisfies PLATFORM-F-072
+ */
+cb_result_code_t cb_env_monitor_start(cb_env_monitor_t *monitor)
+{
+    if (monitor == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    if (monitor->ring == NULL || monitor->running) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    monitor->stop_requested = false;
+
+    if (pthread_create(&monitor->thread, NULL,
+                       monitor_thread_main, monitor) != 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    monitor->running = true;
+    return CB_OK;
+}
+
+/**
+ * @brief Close the monitor's sysfs descriptors
+ * @param monitor Monitor being torn down
+ */
+static void monitor_close_fds(cb_env_monitor_t *monitor)
+{
+#ifdef __linux__
+    if (monitor->fd_freq >= 0) {
+        close(monitor->fd_freq);
+    }
+    if (monitor->fd_temp >= 0) {
+        close(monitor->fd_temp);
+    }
+    if (monitor->fd_throttle >= 0) {
+        close(monitor->fd_throttle);
+    }
+#endif
+    monitor->fd_freq = -1;
+    monitor->fd_temp = -1;
+    monitor->fd_throttle = -1;
+}
+
+/**
+ * @satisfies PLATFORM-F-073 through PLATFORM-F-076
+ */
+cb_result_code_t cb_env_monitor_stop(cb_env_monitor_t *monitor,
+                                     cb_env_stats_t *stats)
+{
+    if (monitor == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    if (monitor->ring == NULL) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    if (monitor->running) {
+        monitor->stop_requested = true;
+        pthread_join(monitor->thread, NULL);
+        monitor->running = false;
+    }
+
+    /* Final sample bounds the run precisely regardless of period */
+    monitor_sample(monitor);
+    monitor_close_fds(monitor);
+
+    if (stats != NULL) {
+        memset(stats, 0, sizeof(*stats));
+        stats->start = monitor->first;
+        stats->end = monitor->last;
+
+        /* True over-run extrema (PLATFORM-F-074, PLATFORM-F-075) */
+        stats->min_freq_hz = monitor->have_freq ? monitor->min_freq_hz : 0;
+        stats->max_freq_hz = monitor->have_freq ? monitor->max_freq_hz : 0;
+        stats->min_temp_mC = monitor->have_temp ? monitor->min_temp_mC : 0;
+        stats->max_temp_mC = monitor->have_temp ? monitor->max_temp_mC : 0;
+
+        if (monitor->last.throttle_count >= monitor->first.throttle_count) {
+            stats->total_throttle_events =
+                monitor->last.throttle_count - monitor->first.throttle_count;
+        } else {
+            /* Counter wrapped or reset */
+            stats->total_throttle_events = 0;
+        }
+    }
+
+    /* Require re-initialisation before reuse */
+    monitor->ring = NULL;
+
+    return CB_OK;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Cache Control (SRS-006-PLATFORM §4.8)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#define CACHE_LINE_SIZE 64U
+
+#if !(defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+/* Fallback eviction buffer — sized to exceed typical last-level caches */
+#define EVICT_BUFFER_SIZE (8U * 1024U * 1024U)
+static uint8_t g_evict_buffer[EVICT_BUFFER_SIZE];
+#endif
+
+/**
+ * @satisfies PLATFORM-F-080 through PLATFORM-F-082
+ */
+cb_result_code_t cb_cache_flush_range(const void *ptr, uint64_t size)
+{
+    if (ptr == NULL && size > 0) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (size == 0) {
+        return CB_OK;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    {
+        const uint8_t *line =
+            (const uint8_t *)((uintptr_t)ptr &
+                              ~(uintptr_t)(CACHE_LINE_SIZE - 1U));
+        const uint8_t *end = (const uint8_t *)ptr + size;
+
+        for (; line < end; line += CACHE_LINE_SIZE) {
+            __asm__ volatile("clflush (%0)" : : "r"(line) : "memory");
+        }
+        /* clflush is only ordered by mfence — without it, later loads
+         * could complete before the flushes retire */
+        __asm__ volatile("mfence" ::: "memory");
+    }
+    return CB_OK;
+#elif defined(__aarch64__)
+    {
+        const uint8_t *line =
+            (const uint8_t *)((uintptr_t)ptr &
+                              ~(uintptr_t)(CACHE_LINE_SIZE - 1U));
+        const uint8_t *end = (const uint8_t *)ptr + size;
+
+        /* DC CIVAC from EL0 requires SCTLR_EL1.UCI, which Linux sets */
+        for (; line < end; line += CACHE_LINE_SIZE) {
+            __asm__ volatile("dc civac, %0" : : "r"(line) : "memory");
+        }
+        __asm__ volatile("dsb sy" ::: "memory");
+    }
+    return CB_OK;
+#else
+    {
+        /* No line-flush instruction — displace the range by sweeping a
+         * buffer larger than the last-level cache */
+        volatile uint8_t *evict = g_evict_buffer;
+        uint32_t i;
+
+        (void)ptr;
+        for (i = 0; i < EVICT_BUFFER_SIZE; i += CACHE_LINE_SIZE) {
+            evict[i] = (uint8_t)(evict[i] + 1U);
+        }
+    }
+    return CB_OK;
+#endif
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Platform Initialisation
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -11,80 +11,191 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#define _GNU_SOURCE  /* O_APPEND row writes, shard directory scanning */
+
 #include "cb_report.h"
+#include "cb_metrics.h"
 #include "cb_verify.h"
 
 #include <stdio.h>
 #include <stdlib.h>  /* strtoull, strtoll */
 #include <string.h>
 #include <inttypes.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 /*─────────────────────────────────────────────────────────────────────────────
- * JSON Output Helpers
+ * Buffered JSON Emitter (REPORT-NF-004)
+ *
+ * The whole document is assembled in a caller-provided buffer and
+ * flushed with a single write. Per-field stdio formatting dominated
+ * report emission on high-latency filesystems (one fprintf per field,
+ * thousands with a full histogram); the emitter replaces that with
+ * memcpy-sized appends and a branch-free integer-to-decimal formatter.
  *─────────────────────────────────────────────────────────────────────────────*/
 
+/**
+ * @brief Append-only view over a caller-provided output buffer
+ *
+ * Overflow latches: once an append would exceed capacity the buffer
+ * stops growing and the finished document is reported as truncated,
+ * so callers never see a silently cut-off report.
+ */
+typedef struct {
+    char *buf;                 /**< Caller-provided output buffer */
+    size_t capacity;           /**< Buffer capacity in bytes */
+    size_t len;                /**< Bytes written so far */
+    bool overflow;             /**< An append did not fit */
+} json_buf_t;
+
+/**
+ * @brief Append raw bytes
+ */
+static void buf_append(json_buf_t *jb, const char *data, size_t n)
+{
+    if (jb->overflow || jb->capacity - jb->len < n) {
+        jb->overflow = true;
+        return;
+    }
+    memcpy(jb->buf + jb->len, data, n);
+    jb->len += n;
+}
+
+/**
+ * @brief Append a null-terminated string
+ */
+static void buf_puts(json_buf_t *jb, const char *s)
+{
+    buf_append(jb, s, strlen(s));
+}
+
+/**
+ * @brief Append indentation, key, and separator: `"key": `
+ */
+static void buf_key(json_buf_t *jb, const char *key, int indent)
+{
+    static const char spaces[] = "        ";
+
+    buf_append(jb, spaces, (size_t)indent);
+    buf_append(jb, "\"", 1);
+    buf_puts(jb, key);
+    buf_append(jb, "\": ", 3);
+}
+
+/**
+ * @brief Append the value terminator: comma (or not) plus newline
+ */
+static void buf_end_value(json_buf_t *jb, int comma)
+{
+    buf_append(jb, comma ? ",\n" : "\n", comma ? 2 : 1);
+}
+
+/**
+ * @brief Append a uint64 in decimal without stdio
+ *
+ * Digits are generated least-significant first into a 20-byte scratch
+ * (the width of UINT64_MAX) and appended reversed.
+ */
+static void buf_put_u64(json_buf_t *jb, uint64_t value)
+{
+    char tmp[20];
+    char out[20];
+    size_t n = 0;
+    size_t i;
+
+    do {
+        tmp[n++] = (char)('0' + (char)(value % 10));
+        value /= 10;
+    } while (value > 0);
+
+    for (i = 0; i < n; i++) {
+        out[i] = tmp[n - 1 - i];
+    }
+    buf_append(jb, out, n);
+}
+
 /**
  * @brief Write hash as 64-character lowercase hex string
  * @satisfies REPORT-F-012
  */
-static void write_hash_json(FILE *fp, const char *key, const cb_hash_t *hash, int indent, int comma)
+static void write_hash_json(json_buf_t *jb, const char *key, const cb_hash_t *hash, int indent, int comma)
 {
     char hex[65];
     cb_hash_to_hex(hash, hex);
-    fprintf(fp, "%*s\"%s\": \"%s\"%s\n", indent, "", key, hex, comma ? "," : "");
+    buf_key(jb, key, indent);
+    buf_append(jb, "\"", 1);
+    buf_append(jb, hex, 64);
+    buf_append(jb, "\"", 1);
+    buf_end_value(jb, comma);
 }
 
 /**
  * @brief Write boolean as JSON true/false
  */
-static void write_bool_json(FILE *fp, const char *key, bool value, int indent, int comma)
+static void write_bool_json(json_buf_t *jb, const char *key, bool value, int indent, int comma)
 {
-    fprintf(fp, "%*s\"%s\": %s%s\n", indent, "", key, value ? "true" : "false", comma ? "," : "");
+    buf_key(jb, key, indent);
+    buf_puts(jb, value ? "true" : "false");
+    buf_end_value(jb, comma);
 }
 
 /**
  * @brief Write uint64 as JSON number
  * @satisfies REPORT-NF-002 (integers only)
  */
-static void write_u64_json(FILE *fp, const char *key, uint64_t value, int indent, int comma)
+static void write_u64_json(json_buf_t *jb, const char *key, uint64_t value, int indent, int comma)
 {
-    fprintf(fp, "%*s\"%s\": %" PRIu64 "%s\n", indent, "", key, value, comma ? "," : "");
+    buf_key(jb, key, indent);
+    buf_put_u64(jb, value);
+    buf_end_value(jb, comma);
 }
 
 /**
  * @brief Write uint32 as JSON number
  */
-static void write_u32_json(FILE *fp, const char *key, uint32_t value, int indent, int comma)
+static void write_u32_json(json_buf_t *jb, const char *key, uint32_t value, int indent, int comma)
 {
-    fprintf(fp, "%*s\"%s\": %" PRIu32 "%s\n", indent, "", key, value, comma ? "," : "");
+    write_u64_json(jb, key, value, indent, comma);
 }
 
 /**
  * @brief Write int32 as JSON number
  */
-static void write_i32_json(FILE *fp, const char *key, int32_t value, int indent, int comma)
+static void write_i32_json(json_buf_t *jb, const char *key, int32_t value, int indent, int comma)
 {
-    fprintf(fp, "%*s\"%s\": %" PRId32 "%s\n", indent, "", key, value, comma ? "," : "");
+    buf_key(jb, key, indent);
+    if (value < 0) {
+        buf_append(jb, "-", 1);
+        buf_put_u64(jb, (uint64_t)(-(int64_t)value));
+    } else {
+        buf_put_u64(jb, (uint64_t)value);
+    }
+    buf_end_value(jb, comma);
 }
 
 /**
  * @brief Write string as JSON string (with escaping)
  */
-static void write_str_json(FILE *fp, const char *key, const char *value, int indent, int comma)
+static void write_str_json(json_buf_t *jb, const char *key, const char *value, int indent, int comma)
 {
-    fprintf(fp, "%*s\"%s\": \"", indent, "", key);
+    const char *p;
+
+    buf_key(jb, key, indent);
+    buf_append(jb, "\"", 1);
     /* Simple escaping for common characters */
-    for (const char *p = value; *p; p++) {
+    for (p = value; *p; p++) {
         switch (*p) {
-            case '"':  fprintf(fp, "\\\""); break;
-            case '\\': fprintf(fp, "\\\\"); break;
-            case '\n': fprintf(fp, "\\n"); break;
-            case '\r': fprintf(fp, "\\r"); break;
-            case '\t': fprintf(fp, "\\t"); break;
-            default:   fputc(*p, fp); break;
+            case '"':  buf_append(jb, "\\\"", 2); break;
+            case '\\': buf_append(jb, "\\\\", 2); break;
+            case '\n': buf_append(jb, "\\n", 2); break;
+            case '\r': buf_append(jb, "\\r", 2); break;
+            case '\t': buf_append(jb, "\\t", 2); break;
+            default:   buf_append(jb, p, 1); break;
         }
     }
-    fprintf(fp, "\"%s\n", comma ? "," : "");
+    buf_append(jb, "\"", 1);
+    buf_end_value(jb, comma);
 }
 
 /*─────────────────────────────────────────────────────────────────────────────
@@ -92,129 +203,270 @@ static void write_str_json(FILE *fp, const char *key, const char *value, int ind
  *─────────────────────────────────────────────────────────────────────────────*/
 
 /**
- * @brief Write results to JSON stream
+ * @brief Emit the complete JSON document into the buffer
  * @satisfies REPORT-F-001 through REPORT-F-015, REPORT-NF-001..003
  */
-cb_result_code_t cb_write_json_fp(const cb_result_t *result, FILE *fp)
+static void emit_json(const cb_result_t *result, json_buf_t *jb)
 {
-    if (result == NULL || fp == NULL) {
-        return CB_ERR_NULL_PTR;
-    }
+    uint32_t i;
 
     /* REPORT-F-015: 2-space indentation */
     /* REPORT-NF-003: Fixed key order for determinism */
 
-    fprintf(fp, "{\n");
+    buf_puts(jb, "{\n");
 
     /* REPORT-F-002: Version */
-    write_str_json(fp, "version", "1.0", 2, 1);
+    write_str_json(jb, "version", "1.0", 2, 1);
 
     /* REPORT-F-003: Platform */
-    write_str_json(fp, "platform", result->platform, 2, 1);
+    write_str_json(jb, "platform", result->platform, 2, 1);
 
     /* REPORT-F-004: CPU model */
-    write_str_json(fp, "cpu_model", result->cpu_model, 2, 1);
-    write_u32_json(fp, "cpu_freq_mhz", result->cpu_freq_mhz, 2, 1);
+    write_str_json(jb, "cpu_model", result->cpu_model, 2, 1);
+    write_u32_json(jb, "cpu_freq_mhz", result->cpu_freq_mhz, 2, 1);
 
     /* REPORT-F-005: Configuration */
-    fprintf(fp, "  \"config\": {\n");
-    write_u32_json(fp, "warmup_iterations", result->warmup_iterations, 4, 1);
-    write_u32_json(fp, "measure_iterations", result->measure_iterations, 4, 1);
-    write_u32_json(fp, "batch_size", result->batch_size, 4, 0);
-    fprintf(fp, "  },\n");
+    buf_puts(jb, "  \"config\": {\n");
+    write_u32_json(jb, "warmup_iterations", result->warmup_iterations, 4, 1);
+    write_u32_json(jb, "measure_iterations", result->measure_iterations, 4, 1);
+    write_u32_json(jb, "batch_size", result->batch_size, 4, 1);
+    write_u32_json(jb, "timing_batch", result->timing_batch, 4, 1);
+    write_bool_json(jb, "cold_cache", result->cold_cache, 4, 1);
+    write_bool_json(jb, "streaming", result->streaming, 4, 0);
+    buf_puts(jb, "  },\n");
 
     /* REPORT-F-006: Latency statistics */
-    fprintf(fp, "  \"latency\": {\n");
-    write_u64_json(fp, "min_ns", result->latency.min_ns, 4, 1);
-    write_u64_json(fp, "max_ns", result->latency.max_ns, 4, 1);
-    write_u64_json(fp, "mean_ns", result->latency.mean_ns, 4, 1);
-    write_u64_json(fp, "median_ns", result->latency.median_ns, 4, 1);
-    write_u64_json(fp, "p95_ns", result->latency.p95_ns, 4, 1);
-    write_u64_json(fp, "p99_ns", result->latency.p99_ns, 4, 1);
-    write_u64_json(fp, "stddev_ns", result->latency.stddev_ns, 4, 1);
-    write_u64_json(fp, "variance_ns2", result->latency.variance_ns2, 4, 1);
-    write_u32_json(fp, "sample_count", result->latency.sample_count, 4, 1);
-    write_u32_json(fp, "outlier_count", result->latency.outlier_count, 4, 1);
-    write_u64_json(fp, "wcet_observed_ns", result->latency.wcet_observed_ns, 4, 1);
-    write_u64_json(fp, "wcet_bound_ns", result->latency.wcet_bound_ns, 4, 0);
-    fprintf(fp, "  },\n");
+    buf_puts(jb, "  \"latency\": {\n");
+    write_u64_json(jb, "min_ns", result->latency.min_ns, 4, 1);
+    write_u64_json(jb, "max_ns", result->latency.max_ns, 4, 1);
+    write_u64_json(jb, "mean_ns", result->latency.mean_ns, 4, 1);
+    write_u64_json(jb, "median_ns", result->latency.median_ns, 4, 1);
+    write_u64_json(jb, "p95_ns", result->latency.p95_ns, 4, 1);
+    write_u64_json(jb, "p99_ns", result->latency.p99_ns, 4, 1);
+    write_u64_json(jb, "stddev_ns", result->latency.stddev_ns, 4, 1);
+    write_u64_json(jb, "variance_ns2", result->latency.variance_ns2, 4, 1);
+    write_u32_json(jb, "sample_count", result->latency.sample_count, 4, 1);
+    write_u32_json(jb, "outlier_count", result->latency.outlier_count, 4, 1);
+    write_u64_json(jb, "wcet_observed_ns", result->latency.wcet_observed_ns, 4, 1);
+    write_u64_json(jb, "wcet_bound_ns", result->latency.wcet_bound_ns, 4, 0);
+    buf_puts(jb, "  },\n");
 
     /* REPORT-F-007: Throughput */
-    fprintf(fp, "  \"throughput\": {\n");
-    write_u64_json(fp, "inferences_per_sec", result->throughput.inferences_per_sec, 4, 1);
-    write_u64_json(fp, "samples_per_sec", result->throughput.samples_per_sec, 4, 1);
-    write_u64_json(fp, "bytes_per_sec", result->throughput.bytes_per_sec, 4, 1);
-    write_u32_json(fp, "batch_size", result->throughput.batch_size, 4, 0);
-    fprintf(fp, "  },\n");
+    buf_puts(jb, "  \"throughput\": {\n");
+    write_u64_json(jb, "inferences_per_sec", result->throughput.inferences_per_sec, 4, 1);
+    write_u64_json(jb, "samples_per_sec", result->throughput.samples_per_sec, 4, 1);
+    write_u64_json(jb, "bytes_per_sec", result->throughput.bytes_per_sec, 4, 1);
+    write_u32_json(jb, "batch_size", result->throughput.batch_size, 4, 0);
+    buf_puts(jb, "  },\n");
 
     /* REPORT-F-008: Verification */
-    fprintf(fp, "  \"verification\": {\n");
-    write_bool_json(fp, "determinism_verified", result->determinism_verified, 4, 1);
-    write_u32_json(fp, "verification_failures", result->verification_failures, 4, 1);
-    write_hash_json(fp, "output_hash", &result->output_hash, 4, 1);
-    write_hash_json(fp, "result_hash", &result->result_hash, 4, 0);
-    fprintf(fp, "  },\n");
+    buf_puts(jb, "  \"verification\": {\n");
+    write_bool_json(jb, "determinism_verified", result->determinism_verified, 4, 1);
+    write_u32_json(jb, "verification_failures", result->verification_failures, 4, 1);
+    write_hash_json(jb, "output_hash", &result->output_hash, 4, 1);
+    write_hash_json(jb, "result_hash", &result->result_hash, 4, 0);
+    buf_puts(jb, "  },\n");
 
     /* REPORT-F-009: Environment */
-    fprintf(fp, "  \"environment\": {\n");
-    write_bool_json(fp, "stable", result->env_stable, 4, 1);
-    write_u64_json(fp, "start_freq_hz", result->environment.start.cpu_freq_hz, 4, 1);
-    write_u64_json(fp, "end_freq_hz", result->environment.end.cpu_freq_hz, 4, 1);
-    write_u64_json(fp, "min_freq_hz", result->environment.min_freq_hz, 4, 1);
-    write_u64_json(fp, "max_freq_hz", result->environment.max_freq_hz, 4, 1);
-    write_i32_json(fp, "start_temp_mC", result->environment.start.cpu_temp_mC, 4, 1);
-    write_i32_json(fp, "end_temp_mC", result->environment.end.cpu_temp_mC, 4, 1);
-    write_i32_json(fp, "min_temp_mC", result->environment.min_temp_mC, 4, 1);
-    write_i32_json(fp, "max_temp_mC", result->environment.max_temp_mC, 4, 1);
-    write_u32_json(fp, "throttle_events", result->environment.total_throttle_events, 4, 0);
-    fprintf(fp, "  },\n");
+    buf_puts(jb, "  \"environment\": {\n");
+    write_bool_json(jb, "stable", result->env_stable, 4, 1);
+    write_u64_json(jb, "start_freq_hz", result->environment.start.cpu_freq_hz, 4, 1);
+    write_u64_json(jb, "end_freq_hz", result->environment.end.cpu_freq_hz, 4, 1);
+    write_u64_json(jb, "min_freq_hz", result->environment.min_freq_hz, 4, 1);
+    write_u64_json(jb, "max_freq_hz", result->environment.max_freq_hz, 4, 1);
+    write_i32_json(jb, "start_temp_mC", result->environment.start.cpu_temp_mC, 4, 1);
+    write_i32_json(jb, "end_temp_mC", result->environment.end.cpu_temp_mC, 4, 1);
+    write_i32_json(jb, "min_temp_mC", result->environment.min_temp_mC, 4, 1);
+    write_i32_json(jb, "max_temp_mC", result->environment.max_temp_mC, 4, 1);
+    write_u32_json(jb, "throttle_events", result->environment.total_throttle_events, 4, 0);
+    buf_puts(jb, "  },\n");
+
+    /* Isolation state (SRS-003-RUNNER §4.9) */
+    buf_puts(jb, "  \"isolation\": {\n");
+    write_bool_json(jb, "active", result->isolation_active, 4, 1);
+    write_u32_json(jb, "core", result->isolation_core, 4, 1);
+    write_bool_json(jb, "mlock", result->isolation_mlock, 4, 1);
+    write_bool_json(jb, "priority", result->isolation_priority, 4, 0);
+    buf_puts(jb, "  },\n");
+
+    /* Adaptive stopping state (SRS-003-RUNNER §4.11) */
+    buf_puts(jb, "  \"adaptive\": {\n");
+    write_bool_json(jb, "enabled", result->adaptive_stop, 4, 1);
+    write_bool_json(jb, "stopped_early", result->stopped_early, 4, 1);
+    write_u32_json(jb, "ci_achieved_q16", result->ci_achieved_q16, 4, 1);
+    write_u32_json(jb, "warmup_consumed", result->warmup_consumed, 4, 0);
+    buf_puts(jb, "  },\n");
+
+    /* Overhead accounting (SRS-003-RUNNER §4.12, CB-MATH-001 §7.2) */
+    buf_puts(jb, "  \"overhead\": {\n");
+    write_u64_json(jb, "warmup_ns", result->overhead.warmup_ns, 4, 1);
+    write_u64_json(jb, "timed_ns", result->overhead.timed_ns, 4, 1);
+    write_u64_json(jb, "verify_ns", result->overhead.verify_ns, 4, 1);
+    write_u64_json(jb, "stats_ns", result->overhead.stats_ns, 4, 1);
+    write_u64_json(jb, "total_ns", result->overhead.total_ns, 4, 0);
+    buf_puts(jb, "  },\n");
+
+    /* Outlier forensics (SRS-003-RUNNER §4.15): one object per
+     * captured tail sample. captured may exceed the records held when
+     * the ring wrapped — the ring then holds the most recent events. */
+    buf_puts(jb, "  \"forensics\": {\n");
+    if (result->forensic_captured > 0 && result->forensic_ring != NULL) {
+        uint32_t held = (result->forensic_captured < result->forensic_capacity)
+                            ? result->forensic_captured
+                            : result->forensic_capacity;
+        write_u32_json(jb, "captured", result->forensic_captured, 4, 1);
+        write_u32_json(jb, "records_held", held, 4, 1);
+        buf_puts(jb, "    \"records\": [\n");
+        for (i = 0; i < held; i++) {
+            const cb_forensic_t *rec = &result->forensic_ring[i];
+            buf_puts(jb, "      { \"iteration\": ");
+            buf_put_u64(jb, rec->iteration);
+            buf_puts(jb, ", \"latency_ns\": ");
+            buf_put_u64(jb, rec->latency_ns);
+            buf_puts(jb, ", \"cycles\": ");
+            buf_put_u64(jb, rec->cycles);
+            buf_puts(jb, ", \"instructions\": ");
+            buf_put_u64(jb, rec->instructions);
+            buf_puts(jb, ", \"cache_misses\": ");
+            buf_put_u64(jb, rec->cache_misses);
+            buf_puts(jb, ",\n        \"cpu_freq_hz\": ");
+            buf_put_u64(jb, rec->env.cpu_freq_hz);
+            buf_puts(jb, ", \"cpu_temp_mC\": ");
+            if (rec->env.cpu_temp_mC < 0) {
+                buf_puts(jb, "-");
+                buf_put_u64(jb, (uint64_t)(-(int64_t)rec->env.cpu_temp_mC));
+            } else {
+                buf_put_u64(jb, (uint64_t)rec->env.cpu_temp_mC);
+            }
+            buf_puts(jb, ", \"throttle_count\": ");
+            buf_put_u64(jb, rec->env.throttle_count);
+            buf_puts(jb, (i + 1 < held) ? " },\n" : " }\n");
+        }
+        buf_puts(jb, "    ]\n");
+    } else {
+        write_u32_json(jb, "captured", result->forensic_captured, 4, 1);
+        write_u32_json(jb, "records_held", 0, 4, 0);
+    }
+    buf_puts(jb, "  },\n");
 
     /* REPORT-F-060..063: Histogram (if valid) */
-    fprintf(fp, "  \"histogram\": {\n");
-    write_bool_json(fp, "valid", result->histogram_valid, 4, 1);
+    buf_puts(jb, "  \"histogram\": {\n");
+    write_bool_json(jb, "valid", result->histogram_valid, 4, 1);
     if (result->histogram_valid && result->histogram.bins != NULL) {
-        write_u64_json(fp, "range_min_ns", result->histogram.range_min_ns, 4, 1);
-        write_u64_json(fp, "range_max_ns", result->histogram.range_max_ns, 4, 1);
-        write_u64_json(fp, "bin_width_ns", result->histogram.bin_width_ns, 4, 1);
-        write_u32_json(fp, "num_bins", result->histogram.num_bins, 4, 1);
-        write_u32_json(fp, "overflow_count", result->histogram.overflow_count, 4, 1);
-        write_u32_json(fp, "underflow_count", result->histogram.underflow_count, 4, 1);
+        /* bin_width_ns == 0 marks variable-width (logarithmic) bins */
+        buf_puts(jb, result->histogram.bin_width_ns == 0
+                         ? "    \"scale\": \"log\",\n"
+                         : "    \"scale\": \"linear\",\n");
+        write_u64_json(jb, "range_min_ns", result->histogram.range_min_ns, 4, 1);
+        write_u64_json(jb, "range_max_ns", result->histogram.range_max_ns, 4, 1);
+        write_u64_json(jb, "bin_width_ns", result->histogram.bin_width_ns, 4, 1);
+        write_u32_json(jb, "num_bins", result->histogram.num_bins, 4, 1);
+        write_u32_json(jb, "overflow_count", result->histogram.overflow_count, 4, 1);
+        write_u32_json(jb, "underflow_count", result->histogram.underflow_count, 4, 1);
+
+        /* Variable-width bins carry their own bounds — emit lower bounds
+         * so readers can reconstruct the bucket layout */
+        if (result->histogram.bin_width_ns == 0) {
+            buf_puts(jb, "    \"bin_min_ns\": [");
+            for (i = 0; i < result->histogram.num_bins; i++) {
+                if (i > 0) buf_puts(jb, ", ");
+                if (i % 10 == 0 && i > 0) buf_puts(jb, "\n      ");
+                buf_put_u64(jb, result->histogram.bins[i].min_ns);
+            }
+            buf_puts(jb, "],\n");
+        }
         /* Bins array */
-        fprintf(fp, "    \"bins\": [");
-        for (uint32_t i = 0; i < result->histogram.num_bins; i++) {
-            if (i > 0) fprintf(fp, ", ");
-            if (i % 20 == 0 && i > 0) fprintf(fp, "\n      ");
-            fprintf(fp, "%" PRIu32, result->histogram.bins[i].count);
+        buf_puts(jb, "    \"bins\": [");
+        for (i = 0; i < result->histogram.num_bins; i++) {
+            if (i > 0) buf_puts(jb, ", ");
+            if (i % 20 == 0 && i > 0) buf_puts(jb, "\n      ");
+            buf_put_u64(jb, result->histogram.bins[i].count);
         }
-        fprintf(fp, "]\n");
+        buf_puts(jb, "]\n");
     } else {
-        write_u64_json(fp, "range_min_ns", 0, 4, 1);
-        write_u64_json(fp, "range_max_ns", 0, 4, 1);
-        write_u32_json(fp, "num_bins", 0, 4, 0);
+        write_u64_json(jb, "range_min_ns", 0, 4, 1);
+        write_u64_json(jb, "range_max_ns", 0, 4, 1);
+        write_u32_json(jb, "num_bins", 0, 4, 0);
     }
-    fprintf(fp, "  },\n");
+    buf_puts(jb, "  },\n");
 
     /* REPORT-F-010: Faults */
-    fprintf(fp, "  \"faults\": {\n");
-    write_bool_json(fp, "overflow", result->faults.overflow, 4, 1);
-    write_bool_json(fp, "underflow", result->faults.underflow, 4, 1);
-    write_bool_json(fp, "div_zero", result->faults.div_zero, 4, 1);
-    write_bool_json(fp, "timer_error", result->faults.timer_error, 4, 1);
-    write_bool_json(fp, "verify_fail", result->faults.verify_fail, 4, 1);
-    write_bool_json(fp, "thermal_drift", result->faults.thermal_drift, 4, 0);
-    fprintf(fp, "  },\n");
+    buf_puts(jb, "  \"faults\": {\n");
+    write_bool_json(jb, "overflow", result->faults.overflow, 4, 1);
+    write_bool_json(jb, "underflow", result->faults.underflow, 4, 1);
+    write_bool_json(jb, "div_zero", result->faults.div_zero, 4, 1);
+    write_bool_json(jb, "timer_error", result->faults.timer_error, 4, 1);
+    write_bool_json(jb, "verify_fail", result->faults.verify_fail, 4, 1);
+    write_bool_json(jb, "thermal_drift", result->faults.thermal_drift, 4, 0);
+    buf_puts(jb, "  },\n");
 
     /* Timing metadata */
-    write_u64_json(fp, "benchmark_start_ns", result->benchmark_start_ns, 2, 1);
-    write_u64_json(fp, "benchmark_end_ns", result->benchmark_end_ns, 2, 1);
-    write_u64_json(fp, "benchmark_duration_ns", result->benchmark_duration_ns, 2, 1);
+    write_u64_json(jb, "benchmark_start_ns", result->benchmark_start_ns, 2, 1);
+    write_u64_json(jb, "benchmark_end_ns", result->benchmark_end_ns, 2, 1);
+    write_u64_json(jb, "benchmark_duration_ns", result->benchmark_duration_ns, 2, 1);
 
     /* REPORT-F-011: Timestamp */
-    write_u64_json(fp, "timestamp_unix", result->timestamp_unix, 2, 0);
+    write_u64_json(jb, "timestamp_unix", result->timestamp_unix, 2, 0);
 
-    fprintf(fp, "}\n");
+    buf_puts(jb, "}\n");
+}
 
-    if (ferror(fp)) {
+/**
+ * @brief Assemble the JSON document in a caller-provided buffer
+ * @satisfies REPORT-F-001 through REPORT-F-015, REPORT-NF-004
+ */
+cb_result_code_t cb_write_json_buf(const cb_result_t *result,
+                                   char *buf,
+                                   size_t capacity,
+                                   size_t *length)
+{
+    json_buf_t jb;
+
+    if (result == NULL || buf == NULL || length == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    jb.buf = buf;
+    jb.capacity = capacity;
+    jb.len = 0;
+    jb.overflow = false;
+
+    emit_json(result, &jb);
+
+    if (jb.overflow) {
+        *length = 0;
+        return CB_ERR_OUT_OF_MEMORY;
+    }
+
+    *length = jb.len;
+    return CB_OK;
+}
+
+/**
+ * @brief Write results to JSON stream
+ *
+ * The document is assembled in memory first, so the stream sees
+ * exactly one write — on high-latency filesystems this is the
+ * difference between thousands of small stdio flushes and one I/O.
+ *
+ * @satisfies REPORT-F-001 through REPORT-F-015, REPORT-NF-001..004
+ */
+cb_result_code_t cb_write_json_fp(const cb_result_t *result, FILE *fp)
+{
+    static char buffer[CB_JSON_MAX_SIZE];
+    size_t length;
+    cb_result_code_t rc;
+
+    if (result == NULL || fp == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    rc = cb_write_json_buf(result, buffer, sizeof(buffer), &length);
+    if (rc != CB_OK) {
+        return rc;
+    }
+
+    if (fwrite(buffer, 1, length, fp) != length || ferror(fp)) {
         return CB_ERR_IO;
     }
 
@@ -262,30 +514,51 @@ static void write_csv_header(FILE *fp)
                 "stddev_ns,inferences_per_sec,determinism_verified,output_hash,timestamp_unix\n");
 }
 
+/** A full CSV row comfortably fits: strings are length-capped and the
+ * ten u64 fields are at most 20 digits each */
+#define CSV_ROW_MAX 512
+
 /**
- * @brief Write CSV data row
+ * @brief Format one CSV data row into a caller-provided buffer
  * @satisfies REPORT-F-022, REPORT-F-024, REPORT-F-025
+ * @return Row length in bytes (excluding the terminator)
  */
-static void write_csv_row(FILE *fp, const cb_result_t *result)
+static size_t format_csv_row(const cb_result_t *result, char *buf,
+                             size_t capacity)
 {
     char hash_hex[65];
+    int n;
+
     cb_hash_to_hex(&result->output_hash, hash_hex);
 
     /* REPORT-F-025: Quote strings containing commas */
-    fprintf(fp, "%s,\"%s\",", result->platform, result->cpu_model);
-
-    fprintf(fp, "%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",",
-            result->latency.min_ns, result->latency.max_ns,
-            result->latency.mean_ns, result->latency.median_ns);
+    n = snprintf(buf, capacity,
+                 "%s,\"%s\","
+                 "%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ","
+                 "%" PRIu64 ",%" PRIu64 ",%" PRIu64 ","
+                 "%" PRIu64 ",%s,%s,%" PRIu64 "\n",
+                 result->platform, result->cpu_model,
+                 result->latency.min_ns, result->latency.max_ns,
+                 result->latency.mean_ns, result->latency.median_ns,
+                 result->latency.p95_ns, result->latency.p99_ns,
+                 result->latency.stddev_ns,
+                 result->throughput.inferences_per_sec,
+                 result->determinism_verified ? "true" : "false",
+                 hash_hex,
+                 result->timestamp_unix);
+
+    return (n > 0 && (size_t)n < capacity) ? (size_t)n : 0;
+}
 
-    fprintf(fp, "%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",",
-            result->latency.p95_ns, result->latency.p99_ns, result->latency.stddev_ns);
+/**
+ * @brief Write CSV data row
+ */
+static void write_csv_row(FILE *fp, const cb_result_t *result)
+{
+    char row[CSV_ROW_MAX];
+    size_t length = format_csv_row(result, row, sizeof(row));
 
-    fprintf(fp, "%" PRIu64 ",%s,%s,%" PRIu64 "\n",
-            result->throughput.inferences_per_sec,
-            result->determinism_verified ? "true" : "false",
-            hash_hex,
-            result->timestamp_unix);
+    fwrite(row, 1, length, fp);
 }
 
 /**
@@ -322,23 +595,252 @@ cb_result_code_t cb_write_csv(const cb_result_t *result, const char *path)
 
 /**
  * @brief Append result to CSV file (data row only)
+ *
+ * The whole row is emitted with one write() on an O_APPEND descriptor,
+ * which POSIX keeps atomic for regular files — concurrent appenders
+ * never interleave within a row, so no lock is needed (REPORT-F-027).
  */
 cb_result_code_t cb_append_csv(const cb_result_t *result, const char *path)
 {
+    char row[CSV_ROW_MAX];
+    size_t length;
+    ssize_t written;
+    int fd;
+
+    if (result == NULL || path == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    length = format_csv_row(result, row, sizeof(row));
+    if (length == 0) {
+        return CB_ERR_OVERFLOW;
+    }
+
+    fd = open(path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd < 0) {
+        return CB_ERR_IO;
+    }
+
+    written = write(fd, row, length);
+    if (close(fd) != 0 || written != (ssize_t)length) {
+        return CB_ERR_IO;
+    }
+
+    return CB_OK;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Sharded CSV Appending (SRS-005-REPORT §4.9)
+ *
+ * Fleet-wide result recording: every process appends to its own shard
+ * file (<base>.shard.<pid>.csv, rows only), so completion is
+ * contention-free regardless of how many per-core benchmark processes
+ * finish at once. cb_csv_merge() later coalesces the shards into the
+ * canonical header-led CSV, in shard-name order for determinism.
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#define CSV_MAX_SHARDS    1024
+#define CSV_SHARD_NAME_MAX 256
+#define CSV_SHARD_INFIX   ".shard."
+
+/**
+ * @satisfies REPORT-F-027, REPORT-F-028
+ */
+cb_result_code_t cb_append_csv_shard(const cb_result_t *result,
+                                     const char *base)
+{
+    char path[CSV_SHARD_NAME_MAX];
+    int n;
+
+    if (result == NULL || base == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    n = snprintf(path, sizeof(path), "%s" CSV_SHARD_INFIX "%ld.csv",
+                 base, (long)getpid());
+    if (n <= 0 || (size_t)n >= sizeof(path)) {
+        return CB_ERR_OVERFLOW;
+    }
+
+    return cb_append_csv(result, path);
+}
+
+/**
+ * @brief Lexicographic insertion sort of shard names
+ *
+ * Shard sets are small (one per process); deterministic order matters
+ * more than asymptotics.
+ */
+static void sort_shard_names(char names[][CSV_SHARD_NAME_MAX], uint32_t count)
+{
+    char key[CSV_SHARD_NAME_MAX];
+    uint32_t i;
+    int32_t j;
+
+    for (i = 1; i < count; i++) {
+        memcpy(key, names[i], CSV_SHARD_NAME_MAX);
+        j = (int32_t)i - 1;
+        while (j >= 0 && strcmp(names[j], key) > 0) {
+            memcpy(names[j + 1], names[j], CSV_SHARD_NAME_MAX);
+            j--;
+        }
+        memcpy(names[j + 1], key, CSV_SHARD_NAME_MAX);
+    }
+}
+
+/**
+ * @satisfies REPORT-F-029
+ */
+cb_result_code_t cb_csv_merge(const char *base, const char *out_path,
+                              bool remove_shards)
+{
+    static char names[CSV_MAX_SHARDS][CSV_SHARD_NAME_MAX];
+    char dir_path[CSV_SHARD_NAME_MAX];
+    char shard_path[2 * CSV_SHARD_NAME_MAX];
+    char block[4096];
+    const char *slash;
+    const char *prefix;
+    size_t prefix_len, name_len, block_len;
+    DIR *dir;
+    struct dirent *entry;
+    FILE *out, *shard;
+    uint32_t num_shards = 0;
+    uint32_t i;
+    cb_result_code_t rc = CB_OK;
+
+    if (base == NULL || out_path == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    /* Split base into directory and shard-name prefix */
+    slash = strrchr(base, '/');
+    if (slash != NULL) {
+        size_t dir_len = (size_t)(slash - base);
+        if (dir_len >= sizeof(dir_path)) {
+            return CB_ERR_OVERFLOW;
+        }
+        memcpy(dir_path, base, dir_len);
+        dir_path[dir_len] = '\0';
+        prefix = slash + 1;
+    } else {
+        dir_path[0] = '.';
+        dir_path[1] = '\0';
+        prefix = base;
+    }
+    prefix_len = strlen(prefix);
+
+    dir = opendir(dir_path);
+    if (dir == NULL) {
+        return CB_ERR_IO;
+    }
+
+    /* Collect "<prefix>.shard.*.csv" entries */
+    while ((entry = readdir(dir)) != NULL) {
+        name_len = strlen(entry->d_name);
+        if (name_len >= CSV_SHARD_NAME_MAX ||
+            name_len < prefix_len + strlen(CSV_SHARD_INFIX) + 4 ||
+            strncmp(entry->d_name, prefix, prefix_len) != 0 ||
+            strncmp(entry->d_name + prefix_len, CSV_SHARD_INFIX,
+                    strlen(CSV_SHARD_INFIX)) != 0 ||
+            strcmp(entry->d_name + name_len - 4, ".csv") != 0) {
+            continue;
+        }
+        if (num_shards == CSV_MAX_SHARDS) {
+            closedir(dir);
+            return CB_ERR_OUT_OF_MEMORY;
+        }
+        memcpy(names[num_shards], entry->d_name, name_len + 1);
+        num_shards++;
+    }
+    closedir(dir);
+
+    sort_shard_names(names, num_shards);
+
+    out = fopen(out_path, "w");
+    if (out == NULL) {
+        return CB_ERR_IO;
+    }
+    write_csv_header(out);
+
+    /* Stream each shard's rows into the canonical file */
+    for (i = 0; i < num_shards && rc == CB_OK; i++) {
+        snprintf(shard_path, sizeof(shard_path), "%.255s/%.255s",
+                 dir_path, names[i]);
+        shard = fopen(shard_path, "r");
+        if (shard == NULL) {
+            rc = CB_ERR_IO;
+            break;
+        }
+        while ((block_len = fread(block, 1, sizeof(block), shard)) > 0) {
+            if (fwrite(block, 1, block_len, out) != block_len) {
+                rc = CB_ERR_IO;
+                break;
+            }
+        }
+        if (ferror(shard)) {
+            rc = CB_ERR_IO;
+        }
+        fclose(shard);
+    }
+
+    if (ferror(out)) {
+        rc = CB_ERR_IO;
+    }
+    if (fclose(out) != 0 && rc == CB_OK) {
+        rc = CB_ERR_IO;
+    }
+
+    /* Compaction: shards are consumed only after a clean merge */
+    if (rc == CB_OK && remove_shards) {
+        for (i = 0; i < num_shards; i++) {
+            snprintf(shard_path, sizeof(shard_path), "%.255s/%.255s",
+                     dir_path, names[i]);
+            if (unlink(shard_path) != 0) {
+                rc = CB_ERR_IO;
+            }
+        }
+    }
+
+    return rc;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Binary Result Format (SRS-005-REPORT §4.6)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+cb_result_code_t cb_write_binary(const cb_result_t *result, const char *path)
+{
+    cb_binary_header_t header;
+    cb_result_t payload;
     FILE *fp;
 
     if (result == NULL || path == NULL) {
         return CB_ERR_NULL_PTR;
     }
 
-    fp = fopen(path, "a");
+    /* Pointers are never meaningful across processes — zero the histogram
+     * reference so the payload (and its checksum) is position-independent */
+    memcpy(&payload, result, sizeof(payload));
+    payload.histogram.bins = NULL;
+    payload.histogram_valid = false;
+    payload.forensic_ring = NULL;
+
+    memset(&header, 0, sizeof(header));
+    header.magic[0] = CB_BINARY_MAGIC_0;
+    header.magic[1] = CB_BINARY_MAGIC_1;
+    header.magic[2] = CB_BINARY_MAGIC_2;
+    header.magic[3] = CB_BINARY_MAGIC_3;
+    header.version = CB_BINARY_VERSION;
+    header.payload_size = (uint32_t)sizeof(cb_result_t);
+    cb_compute_hash(&payload, (uint32_t)sizeof(payload), &header.payload_hash);
+
+    fp = fopen(path, "wb");
     if (fp == NULL) {
         return CB_ERR_IO;
     }
 
-    write_csv_row(fp, result);
-
-    if (ferror(fp)) {
+    if (fwrite(&header, sizeof(header), 1, fp) != 1 ||
+        fwrite(&payload, sizeof(payload), 1, fp) != 1) {
         fclose(fp);
         return CB_ERR_IO;
     }
@@ -350,6 +852,63 @@ cb_result_code_t cb_append_csv(const cb_result_t *result, const char *path)
     return CB_OK;
 }
 
+cb_result_code_t cb_load_binary(const char *path, cb_result_t *result)
+{
+    cb_binary_header_t header;
+    cb_hash_t computed;
+    FILE *fp;
+
+    if (path == NULL || result == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    fp = fopen(path, "rb");
+    if (fp == NULL) {
+        return CB_ERR_IO;
+    }
+
+    if (fread(&header, sizeof(header), 1, fp) != 1) {
+        fclose(fp);
+        return CB_ERR_IO;
+    }
+
+    if (header.magic[0] != CB_BINARY_MAGIC_0 ||
+        header.magic[1] != CB_BINARY_MAGIC_1 ||
+        header.magic[2] != CB_BINARY_MAGIC_2 ||
+        header.magic[3] != CB_BINARY_MAGIC_3 ||
+        header.version != CB_BINARY_VERSION) {
+        fclose(fp);
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* A size mismatch means an incompatible library build wrote the file —
+     * reject rather than misinterpret the payload */
+    if (header.payload_size != (uint32_t)sizeof(cb_result_t)) {
+        fclose(fp);
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    if (fread(result, sizeof(*result), 1, fp) != 1) {
+        fclose(fp);
+        return CB_ERR_IO;
+    }
+    fclose(fp);
+
+    cb_compute_hash(result, (uint32_t)sizeof(*result), &computed);
+    if (!cb_hash_equal(&computed, &header.payload_hash)) {
+        memset(result, 0, sizeof(*result));
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* Defensive: the stored pointer is NULL by construction, but never
+     * trust file contents to carry a valid address */
+    result->histogram.bins = NULL;
+    result->histogram_valid = false;
+    result->forensic_ring = NULL;
+
+    return CB_OK;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * JSON Loading (REPORT-F-030..035)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -540,6 +1099,9 @@ cb_result_code_t cb_load_json(const char *path, cb_result_t *result)
     json_extract_u32(json, "warmup_iterations", &result->warmup_iterations);
     json_extract_u32(json, "measure_iterations", &result->measure_iterations);
     json_extract_u32(json, "batch_size", &result->batch_size);
+    json_extract_u32(json, "timing_batch", &result->timing_batch);
+    json_extract_bool(json, "cold_cache", &result->cold_cache);
+    json_extract_bool(json, "streaming", &result->streaming);
 
     /* Latency - required */
     if (!json_extract_u64(json, "min_ns", &result->latency.min_ns)) {
@@ -587,6 +1149,31 @@ cb_result_code_t cb_load_json(const char *path, cb_result_t *result)
     json_extract_i32(json, "max_temp_mC", &result->environment.max_temp_mC);
     json_extract_u32(json, "throttle_events", &result->environment.total_throttle_events);
 
+    /* Isolation state */
+    json_extract_bool(json, "active", &result->isolation_active);
+    json_extract_u32(json, "core", &result->isolation_core);
+    json_extract_bool(json, "mlock", &result->isolation_mlock);
+    json_extract_bool(json, "priority", &result->isolation_priority);
+
+    /* Adaptive stopping state */
+    json_extract_bool(json, "enabled", &result->adaptive_stop);
+    json_extract_bool(json, "stopped_early", &result->stopped_early);
+    json_extract_u32(json, "ci_achieved_q16", &result->ci_achieved_q16);
+    json_extract_u32(json, "warmup_consumed", &result->warmup_consumed);
+
+    /* Outlier forensics: the count round-trips; the record ring is a
+     * caller-provided buffer and is not reconstructed on load */
+    json_extract_u32(json, "captured", &result->forensic_captured);
+    result->forensic_ring = NULL;
+    result->forensic_capacity = 0;
+
+    /* Overhead accounting */
+    json_extract_u64(json, "warmup_ns", &result->overhead.warmup_ns);
+    json_extract_u64(json, "timed_ns", &result->overhead.timed_ns);
+    json_extract_u64(json, "verify_ns", &result->overhead.verify_ns);
+    json_extract_u64(json, "stats_ns", &result->overhead.stats_ns);
+    json_extract_u64(json, "total_ns", &result->overhead.total_ns);
+
     /* Faults - use temp bool for bit-fields */
     {
         bool tmp;
@@ -685,6 +1272,149 @@ cb_result_code_t cb_compare_results(const cb_result_t *result_a,
     return CB_OK;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Fleet Result Merging (REPORT-F-070..078)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Check that two histograms use identical binning
+ * @param a First histogram
+ * @param b Second histogram
+ * @return true if bin-wise count addition is valid
+ */
+static bool histogram_binning_equal(const cb_histogram_t *a,
+                                    const cb_histogram_t *b)
+{
+    return a->num_bins == b->num_bins &&
+           a->range_min_ns == b->range_min_ns &&
+           a->range_max_ns == b->range_max_ns &&
+           a->bin_width_ns == b->bin_width_ns;
+}
+
+/**
+ * @brief Merge partial results into a fleet-wide result
+ * @satisfies REPORT-F-070 through REPORT-F-078
+ */
+cb_result_code_t cb_result_merge(const cb_result_t *partials,
+                                 uint32_t num,
+                                 cb_result_t *merged,
+                                 cb_histogram_bin_t *bins,
+                                 uint32_t bin_capacity)
+{
+    /* Static staging buffer for the stats merge — no dynamic allocation */
+    static cb_latency_stats_t parts[CB_MERGE_MAX_PARTIALS];
+    cb_fault_flags_t merge_faults;
+    const cb_histogram_t *h0;
+    bool hist_ok;
+    uint32_t i, b;
+
+    if (partials == NULL || merged == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    if (num == 0 || num > CB_MERGE_MAX_PARTIALS) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    memset(merged, 0, sizeof(*merged));
+    cb_fault_clear(&merge_faults);
+
+    /* REPORT-F-071: identification and config echo from first partial */
+    memcpy(merged->platform, partials[0].platform, CB_MAX_PLATFORM);
+    memcpy(merged->cpu_model, partials[0].cpu_model, CB_MAX_CPU_MODEL);
+    merged->cpu_freq_mhz = partials[0].cpu_freq_mhz;
+    merged->warmup_iterations = partials[0].warmup_iterations;
+    merged->measure_iterations = partials[0].measure_iterations;
+    merged->batch_size = partials[0].batch_size;
+    merged->timing_batch = partials[0].timing_batch;
+    merged->timestamp_unix = partials[0].timestamp_unix;
+
+    /* REPORT-F-072: exact pooled mean/variance, conservative percentiles */
+    for (i = 0; i < num; i++) {
+        parts[i] = partials[i].latency;
+    }
+    (void)cb_stats_merge(parts, num, &merged->latency, &merge_faults);
+
+    /* REPORT-F-073: fleet throughput is the sum — nodes ran concurrently */
+    for (i = 0; i < num; i++) {
+        merged->throughput.inferences_per_sec +=
+            partials[i].throughput.inferences_per_sec;
+        merged->throughput.samples_per_sec +=
+            partials[i].throughput.samples_per_sec;
+        merged->throughput.bytes_per_sec +=
+            partials[i].throughput.bytes_per_sec;
+        merged->verification_failures += partials[i].verification_failures;
+    }
+    merged->throughput.batch_size = partials[0].batch_size;
+
+    /* REPORT-F-074: determinism holds only if every node verified */
+    merged->determinism_verified = true;
+    for (i = 0; i < num; i++) {
+        if (!partials[i].determinism_verified) {
+            merged->determinism_verified = false;
+        }
+        /* OR all fault flags into the merged result */
+        if (partials[i].faults.overflow)      merged->faults.overflow = 1;
+        if (partials[i].faults.underflow)     merged->faults.underflow = 1;
+        if (partials[i].faults.div_zero)      merged->faults.div_zero = 1;
+        if (partials[i].faults.timer_error)   merged->faults.timer_error = 1;
+        if (partials[i].faults.verify_fail)   merged->faults.verify_fail = 1;
+        if (partials[i].faults.thermal_drift) merged->faults.thermal_drift = 1;
+    }
+    if (merge_faults.overflow) merged->faults.overflow = 1;
+    if (merge_faults.div_zero) merged->faults.div_zero = 1;
+
+    /* REPORT-F-075: wall clock of the slowest node bounds the fleet run */
+    for (i = 0; i < num; i++) {
+        if (partials[i].benchmark_duration_ns > merged->benchmark_duration_ns) {
+            merged->benchmark_duration_ns = partials[i].benchmark_duration_ns;
+        }
+    }
+
+    /*
+     * REPORT-F-076..078: bin-wise histogram merge. Counts are summable
+     * only when every partial used identical binning; otherwise the
+     * merged histogram is marked invalid rather than silently wrong.
+     */
+    hist_ok = (bins != NULL);
+    h0 = &partials[0].histogram;
+
+    for (i = 0; i < num && hist_ok; i++) {
+        if (!partials[i].histogram_valid ||
+            partials[i].histogram.bins == NULL ||
+            !histogram_binning_equal(&partials[i].histogram, h0)) {
+            hist_ok = false;
+        }
+    }
+    if (hist_ok && h0->num_bins > bin_capacity) {
+        hist_ok = false;
+    }
+
+    if (hist_ok) {
+        merged->histogram = *h0;
+        merged->histogram.bins = bins;
+        merged->histogram.overflow_count = 0;
+        merged->histogram.underflow_count = 0;
+
+        for (b = 0; b < h0->num_bins; b++) {
+            bins[b] = h0->bins[b];
+            bins[b].count = 0;
+        }
+        for (i = 0; i < num; i++) {
+            for (b = 0; b < h0->num_bins; b++) {
+                bins[b].count += partials[i].histogram.bins[b].count;
+            }
+            merged->histogram.overflow_count +=
+                partials[i].histogram.overflow_count;
+            merged->histogram.underflow_count +=
+                partials[i].histogram.underflow_count;
+        }
+        merged->histogram_valid = true;
+    }
+
+    return CB_OK;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Human-Readable Output (REPORT-F-050..058)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -0,0 +1,534 @@
+/**
+ * @file resultdb.c
+ * @brief Indexed result database implementation
+ *
+ * Implements SRS-008-RESULTDB: an append-only data file of framed
+ * cb_result_t records plus an mmap'd index kept sorted on disk by
+ * (key, timestamp). Appends insert their entry in place with one
+ * memmove; queries are binary searches — no directory walks, no
+ * per-result file opens, no dynamic allocation.
+ *
+ * @traceability SRS-008-RESULTDB, CB-STRUCT-001 §10
+ *
+ * Copyright © 2026 The Murray Family Innovation Trust. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#define _GNU_SOURCE  /* pread, ftruncate */
+
+#include "cb_resultdb.h"
+#include "cb_report.h"
+#include "cb_verify.h"
+
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * On-Disk Index Layout
+ *
+ * ┌──────────────────────┬──────────────────────────────────────────┐
+ * │ resultdb_header_t    │ cb_resultdb_entry_t × capacity           │
+ * └──────────────────────┴──────────────────────────────────────────┘
+ *
+ * The file is grown in blocks of INDEX_GROW_ENTRIES so steady-state
+ * appends do not remap; num_entries tracks the sorted logical prefix.
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#define RESULTDB_MAGIC_0 0x43U  /* 'C' */
+#define RESULTDB_MAGIC_1 0x42U  /* 'B' */
+#define RESULTDB_MAGIC_2 0x44U  /* 'D' */
+#define RESULTDB_MAGIC_3 0x42U  /* 'B' */
+#define RESULTDB_VERSION 1U
+
+#define INDEX_GROW_ENTRIES 1024U
+
+typedef struct {
+    uint8_t magic[4];          /* RESULTDB_MAGIC_0..3 */
+    uint32_t version;          /* RESULTDB_VERSION */
+    uint64_t num_entries;      /* Sorted logical entry count */
+} resultdb_header_t;
+
+/**
+ * @brief Header view of an open index mapping
+ */
+static resultdb_header_t *index_header(const cb_resultdb_t *db)
+{
+    return (resultdb_header_t *)db->index_base;
+}
+
+/**
+ * @brief Entry array view of an open index mapping
+ */
+static cb_resultdb_entry_t *index_entries(const cb_resultdb_t *db)
+{
+    return (cb_resultdb_entry_t *)(void *)
+        ((uint8_t *)db->index_base + sizeof(resultdb_header_t));
+}
+
+/**
+ * @brief Entries the current mapping can hold
+ */
+static uint64_t index_capacity(const cb_resultdb_t *db)
+{
+    return (db->index_size - sizeof(resultdb_header_t))
+           / sizeof(cb_resultdb_entry_t);
+}
+
+/**
+ * @brief Entry ordering: (key_hash, timestamp_unix) ascending
+ */
+static bool entry_less(uint64_t key_a, uint64_t ts_a,
+                       uint64_t key_b, uint64_t ts_b)
+{
+    if (key_a != key_b) {
+        return key_a < key_b;
+    }
+    return ts_a < ts_b;
+}
+
+/**
+ * @brief Lower bound: first index whose entry is >= (key, ts)
+ */
+static uint64_t lower_bound(const cb_resultdb_entry_t *entries,
+                            uint64_t num,
+                            uint64_t key,
+                            uint64_t ts)
+{
+    uint64_t lo = 0;
+    uint64_t hi = num;
+    uint64_t mid;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (entry_less(entries[mid].key_hash, entries[mid].timestamp_unix,
+                       key, ts)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Database Lifecycle (SRS-008-RESULTDB §4.1)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Map the index file at its current size
+ */
+static cb_result_code_t map_index(cb_resultdb_t *db)
+{
+    struct stat st;
+    void *base;
+
+    if (fstat(db->index_fd, &st) != 0) {
+        return CB_ERR_IO;
+    }
+
+    base = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE,
+                MAP_SHARED, db->index_fd, 0);
+    if (base == MAP_FAILED) {
+        return CB_ERR_IO;
+    }
+
+    db->index_base = base;
+    db->index_size = (uint64_t)st.st_size;
+    return CB_OK;
+}
+
+/**
+ * @brief Open (or create) a result database
+ * @satisfies RESULTDB-F-001 through RESULTDB-F-004
+ */
+cb_result_code_t cb_resultdb_open(cb_resultdb_t *db,
+                                  const char *data_path,
+                                  const char *index_path)
+{
+    resultdb_header_t header;
+    struct stat st;
+    cb_result_code_t rc;
+
+    if (db == NULL || data_path == NULL || index_path == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    memset(db, 0, sizeof(*db));
+    db->data_fd = -1;
+    db->index_fd = -1;
+
+    db->data_fd = open(data_path, O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (db->data_fd < 0) {
+        return CB_ERR_IO;
+    }
+
+    db->index_fd = open(index_path, O_RDWR | O_CREAT, 0644);
+    if (db->index_fd < 0) {
+        close(db->data_fd);
+        return CB_ERR_IO;
+    }
+
+    if (fstat(db->index_fd, &st) != 0) {
+        close(db->data_fd);
+        close(db->index_fd);
+        return CB_ERR_IO;
+    }
+
+    if (st.st_size == 0) {
+        /* Fresh index: header plus one growth block of entry slots */
+        memset(&header, 0, sizeof(header));
+        header.magic[0] = RESULTDB_MAGIC_0;
+        header.magic[1] = RESULTDB_MAGIC_1;
+        header.magic[2] = RESULTDB_MAGIC_2;
+        header.magic[3] = RESULTDB_MAGIC_3;
+        header.version = RESULTDB_VERSION;
+        header.num_entries = 0;
+
+        if (write(db->index_fd, &header, sizeof(header))
+                != (ssize_t)sizeof(header) ||
+            ftruncate(db->index_fd,
+                      (off_t)(sizeof(header) +
+                              INDEX_GROW_ENTRIES *
+                                  sizeof(cb_resultdb_entry_t))) != 0) {
+            close(db->data_fd);
+            close(db->index_fd);
+            return CB_ERR_IO;
+        }
+    }
+
+    rc = map_index(db);
+    if (rc != CB_OK) {
+        close(db->data_fd);
+        close(db->index_fd);
+        return rc;
+    }
+
+    if (index_header(db)->magic[0] != RESULTDB_MAGIC_0 ||
+        index_header(db)->magic[1] != RESULTDB_MAGIC_1 ||
+        index_header(db)->magic[2] != RESULTDB_MAGIC_2 ||
+        index_header(db)->magic[3] != RESULTDB_MAGIC_3 ||
+        index_header(db)->version != RESULTDB_VERSION) {
+        munmap(db->index_base, (size_t)db->index_size);
+        close(db->data_fd);
+        close(db->index_fd);
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    db->open = true;
+    return CB_OK;
+}
+
+/**
+ * @brief Close a database handle
+ * @satisfies RESULTDB-F-005
+ */
+cb_result_code_t cb_resultdb_close(cb_resultdb_t *db)
+{
+    if (db == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (!db->open) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    munmap(db->index_base, (size_t)db->index_size);
+    close(db->data_fd);
+    close(db->index_fd);
+    memset(db, 0, sizeof(*db));
+    db->data_fd = -1;
+    db->index_fd = -1;
+    return CB_OK;
+}
+
+/**
+ * @brief Number of records in the database
+ * @satisfies RESULTDB-F-006
+ */
+uint64_t cb_resultdb_count(const cb_resultdb_t *db)
+{
+    if (db == NULL || !db->open) {
+        return 0;
+    }
+    return index_header(db)->num_entries;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Keys and Insertion (SRS-008-RESULTDB §4.2)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Derive the 64-bit index key for a result identity
+ * @satisfies RESULTDB-F-010
+ */
+cb_result_code_t cb_resultdb_make_key(const char *platform,
+                                      const char *cpu_model,
+                                      const cb_hash_t *model_hash,
+                                      uint64_t *key)
+{
+    cb_verify_ctx_t ctx;
+    cb_hash_t digest;
+    uint8_t nul = 0;
+    int i;
+
+    if (platform == NULL || cpu_model == NULL || model_hash == NULL ||
+        key == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    /* NUL separators keep ("ab","c") and ("a","bc") on distinct keys */
+    cb_verify_ctx_init(&ctx);
+    cb_verify_ctx_update(&ctx, platform, (uint32_t)strlen(platform));
+    cb_verify_ctx_update(&ctx, &nul, 1);
+    cb_verify_ctx_update(&ctx, cpu_model, (uint32_t)strlen(cpu_model));
+    cb_verify_ctx_update(&ctx, &nul, 1);
+    cb_verify_ctx_update(&ctx, model_hash->bytes, CB_HASH_SIZE);
+    cb_verify_ctx_final(&ctx, &digest);
+
+    *key = 0;
+    for (i = 7; i >= 0; i--) {
+        *key = (*key << 8) | digest.bytes[i];
+    }
+    return CB_OK;
+}
+
+/**
+ * @brief Grow the index file by one block and remap
+ */
+static cb_result_code_t grow_index(cb_resultdb_t *db)
+{
+    uint64_t new_size = db->index_size +
+                        INDEX_GROW_ENTRIES * sizeof(cb_resultdb_entry_t);
+
+    munmap(db->index_base, (size_t)db->index_size);
+    db->index_base = NULL;
+
+    if (ftruncate(db->index_fd, (off_t)new_size) != 0) {
+        db->open = false;
+        return CB_ERR_IO;
+    }
+    if (map_index(db) != CB_OK) {
+        db->open = false;
+        return CB_ERR_IO;
+    }
+    return CB_OK;
+}
+
+/**
+ * @brief Append a result and insert its index entry in sorted order
+ * @satisfies RESULTDB-F-011 through RESULTDB-F-014
+ */
+cb_result_code_t cb_resultdb_append(cb_resultdb_t *db,
+                                    const cb_result_t *result)
+{
+    cb_binary_header_t header;
+    cb_result_t payload;
+    cb_resultdb_entry_t entry;
+    cb_resultdb_entry_t *entries;
+    struct stat st;
+    uint64_t num, pos;
+    cb_result_code_t rc;
+
+    if (db == NULL || result == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (!db->open) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* Frame the record exactly as cb_write_binary(): pointers are
+     * meaningless across processes, so the histogram and forensic
+     * ring references are zeroed before the payload hash is taken */
+    memcpy(&payload, result, sizeof(payload));
+    payload.histogram.bins = NULL;
+    payload.histogram_valid = false;
+    payload.forensic_ring = NULL;
+
+    memset(&header, 0, sizeof(header));
+    header.magic[0] = CB_BINARY_MAGIC_0;
+    header.magic[1] = CB_BINARY_MAGIC_1;
+    header.magic[2] = CB_BINARY_MAGIC_2;
+    header.magic[3] = CB_BINARY_MAGIC_3;
+    header.version = CB_BINARY_VERSION;
+    header.payload_size = (uint32_t)sizeof(cb_result_t);
+    cb_compute_hash(&payload, (uint32_t)sizeof(payload), &header.payload_hash);
+
+    /* O_APPEND: the record lands at end-of-file; its offset is the
+     * size before the write */
+    if (fstat(db->data_fd, &st) != 0) {
+        return CB_ERR_IO;
+    }
+    entry.offset = (uint64_t)st.st_size;
+
+    if (write(db->data_fd, &header, sizeof(header))
+            != (ssize_t)sizeof(header) ||
+        write(db->data_fd, &payload, sizeof(payload))
+            != (ssize_t)sizeof(payload)) {
+        return CB_ERR_IO;
+    }
+
+    rc = cb_resultdb_make_key(payload.platform, payload.cpu_model,
+                              &payload.output_hash, &entry.key_hash);
+    if (rc != CB_OK) {
+        return rc;
+    }
+    entry.timestamp_unix = payload.timestamp_unix;
+
+    num = index_header(db)->num_entries;
+    if (num == index_capacity(db)) {
+        rc = grow_index(db);
+        if (rc != CB_OK) {
+            return rc;
+        }
+    }
+
+    /* Insert at the sorted position; appends of fresh results hit the
+     * tail, so the memmove is usually empty */
+    entries = index_entries(db);
+    pos = lower_bound(entries, num, entry.key_hash, entry.timestamp_unix);
+    if (pos < num) {
+        memmove(&entries[pos + 1], &entries[pos],
+                (size_t)(num - pos) * sizeof(cb_resultdb_entry_t));
+    }
+    entries[pos] = entry;
+    index_header(db)->num_entries = num + 1;
+    return CB_OK;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Queries (SRS-008-RESULTDB §4.3)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Range query: entries for a key within [ts_min, ts_max]
+ * @satisfies RESULTDB-F-020, RESULTDB-F-021
+ */
+cb_result_code_t cb_resultdb_query(const cb_resultdb_t *db,
+                                   uint64_t key,
+                                   uint64_t ts_min,
+                                   uint64_t ts_max,
+                                   cb_resultdb_entry_t *entries,
+                                   uint32_t capacity,
+                                   uint32_t *count)
+{
+    const cb_resultdb_entry_t *idx;
+    uint64_t num, pos;
+    uint32_t n = 0;
+
+    if (db == NULL || entries == NULL || count == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (!db->open) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    idx = index_entries(db);
+    num = index_header(db)->num_entries;
+
+    for (pos = lower_bound(idx, num, key, ts_min);
+         pos < num && idx[pos].key_hash == key &&
+         idx[pos].timestamp_unix <= ts_max;
+         pos++) {
+        if (n == capacity) {
+            *count = n;
+            return CB_ERR_OUT_OF_MEMORY;
+        }
+        entries[n++] = idx[pos];
+    }
+
+    *count = n;
+    return CB_OK;
+}
+
+/**
+ * @brief Latest-N lookup: most recent entries for a key
+ * @satisfies RESULTDB-F-022
+ */
+cb_result_code_t cb_resultdb_latest(const cb_resultdb_t *db,
+                                    uint64_t key,
+                                    uint32_t n,
+                                    cb_resultdb_entry_t *entries,
+                                    uint32_t *count)
+{
+    const cb_resultdb_entry_t *idx;
+    uint64_t num, end;
+    uint32_t got = 0;
+
+    if (db == NULL || entries == NULL || count == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (!db->open) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    idx = index_entries(db);
+    num = index_header(db)->num_entries;
+
+    /* One past the key's newest entry, then walk backwards */
+    end = lower_bound(idx, num, key, UINT64_MAX);
+    if (end < num && idx[end].key_hash == key) {
+        end++;
+    }
+    while (got < n && end > 0 && idx[end - 1].key_hash == key) {
+        entries[got++] = idx[end - 1];
+        end--;
+    }
+
+    *count = got;
+    return CB_OK;
+}
+
+/**
+ * @brief Load the full record behind an index entry
+ * @satisfies RESULTDB-F-023
+ */
+cb_result_code_t cb_resultdb_load(const cb_resultdb_t *db,
+                                  const cb_resultdb_entry_t *entry,
+                                  cb_result_t *result)
+{
+    cb_binary_header_t header;
+    cb_hash_t computed;
+
+    if (db == NULL || entry == NULL || result == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (!db->open) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    if (pread(db->data_fd, &header, sizeof(header),
+              (off_t)entry->offset) != (ssize_t)sizeof(header)) {
+        return CB_ERR_IO;
+    }
+
+    if (header.magic[0] != CB_BINARY_MAGIC_0 ||
+        header.magic[1] != CB_BINARY_MAGIC_1 ||
+        header.magic[2] != CB_BINARY_MAGIC_2 ||
+        header.magic[3] != CB_BINARY_MAGIC_3 ||
+        header.version != CB_BINARY_VERSION ||
+        header.payload_size != (uint32_t)sizeof(cb_result_t)) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    if (pread(db->data_fd, result, sizeof(*result),
+              (off_t)(entry->offset + sizeof(header)))
+            != (ssize_t)sizeof(*result)) {
+        return CB_ERR_IO;
+    }
+
+    cb_compute_hash(result, (uint32_t)sizeof(*result), &computed);
+    if (!cb_hash_equal(&computed, &header.payload_hash)) {
+        memset(result, 0, sizeof(*result));
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* Never trust file contents to carry a valid address */
+    result->histogram.bins = NULL;
+    result->histogram_valid = false;
+    result->forensic_ring = NULL;
+    result->forensic_capacity = 0;
+    return CB_OK;
+}
@@ -19,14 +19,23 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#define _GNU_SOURCE  /* pthread_setaffinity_np, CPU_SET */
+
 #include "cb_runner.h"
 #include "cb_timer.h"
 #include "cb_metrics.h"
 #include "cb_platform.h"
 #include "cb_verify.h"
+#include "cb_data.h"
 
 #include <string.h>
 #include <time.h>
+#include <pthread.h>
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/mman.h>
+#endif
 
 /*─────────────────────────────────────────────────────────────────────────────
  * Configuration API
@@ -53,6 +62,9 @@ cb_result_code_t cb_config_init(cb_config_t *config)
     /* RUNNER-F-004: Default batch_size = 1 */
     config->batch_size = 1;
 
+    /* Default timing_batch = 1 (one call per timestamp pair) */
+    config->timing_batch = 1;
+
     /* RUNNER-F-005: Default timer_source = CB_TIMER_AUTO */
     config->timer_source = CB_TIMER_AUTO;
 
@@ -62,6 +74,33 @@ cb_result_code_t cb_config_init(cb_config_t *config)
     /* RUNNER-F-007: Default monitor_environment = true */
     config->monitor_environment = true;
 
+    /* Isolation defaults: off; when enabled, buffer locking is on */
+    config->isolate = false;
+    config->isolate_mlock = true;
+    config->isolate_priority = false;
+    config->isolate_core = 0;
+
+    /* Adaptive stopping defaults: off; 1% CI target when enabled */
+    config->adaptive_stop = false;
+    config->ci_rel_q16 = 655;       /* ≈ 0.01 in Q16.16 */
+    config->ci_check_interval = 256;
+    config->ci_min_iterations = 100;
+
+    /* Adaptive warmup defaults: off; 2% drift over 16-iteration windows */
+    config->adaptive_warmup = false;
+    config->warmup_window = 16;
+    config->warmup_drift_q16 = 1311;    /* ≈ 0.02 in Q16.16 */
+
+    /* Cold-cache mode defaults: off, no extra flush range (§4.14) */
+    config->cold_cache = false;
+    config->cold_flush_base = NULL;
+    config->cold_flush_size = 0;
+
+    /* Outlier forensics defaults: off (§4.15) */
+    config->forensic_threshold_ns = 0;
+    config->forensic_ring = NULL;
+    config->forensic_capacity = 0;
+
     /* Histogram defaults */
     config->collect_histogram = false;
     config->histogram_bins = 100;
@@ -102,6 +141,27 @@ cb_result_code_t cb_config_validate(const cb_config_t *config)
         return CB_ERR_INVALID_CONFIG;
     }
 
+    /* Adaptive stopping validation (§4.11) */
+    if (config->adaptive_stop && config->ci_rel_q16 == 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* Adaptive warmup validation (§4.3) */
+    if (config->adaptive_warmup && config->warmup_drift_q16 == 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* Cold-cache validation (§4.14): a size without a base is malformed */
+    if (config->cold_flush_size > 0 && config->cold_flush_base == NULL) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* Forensics validation (§4.15): a threshold needs a ring to fill */
+    if (config->forensic_threshold_ns > 0 &&
+        (config->forensic_ring == NULL || config->forensic_capacity == 0)) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
     /* Histogram validation */
     if (config->collect_histogram) {
         if (config->histogram_bins == 0 || config->histogram_bins > CB_MAX_HISTOGRAM) {
@@ -178,6 +238,103 @@ cb_result_code_t cb_runner_init(cb_runner_t *runner,
     return CB_OK;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Execution Isolation (SRS-003-RUNNER §4.9)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Apply the configured isolation phase
+ *
+ * Runs once at the start of warmup, before any measured work: pins the
+ * calling thread to the configured core, locks and prefaults the input,
+ * output and sample buffers, and optionally raises the scheduling
+ * priority. Pinning failure aborts the benchmark (the configured core
+ * does not exist or is not permitted); memory locking and priority are
+ * best effort, with the achieved state recorded in cb_result_t so
+ * certification evidence reflects the actual isolation level.
+ *
+ * @param runner      Initialised runner with config.isolate set
+ * @param input       Input buffer (prefaulted read-only)
+ * @param input_size  Size of input buffer
+ * @param output      Output buffer (prefaulted)
+ * @param output_size Size of output buffer
+ * @return CB_OK on success
+ * @return CB_ERR_INVALID_CONFIG if pinning to isolate_core failed
+ */
+static cb_result_code_t apply_isolation(cb_runner_t *runner,
+                                        const void *input,
+                                        uint32_t input_size,
+                                        void *output,
+                                        uint32_t output_size)
+{
+#ifdef __linux__
+    cpu_set_t cpuset;
+    size_t sample_bytes;
+
+    CPU_ZERO(&cpuset);
+    CPU_SET((size_t)runner->config.isolate_core, &cpuset);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+    runner->isolation_active = true;
+    runner->isolation_core = runner->config.isolate_core;
+
+    if (runner->config.isolate_mlock) {
+        bool locked = true;
+
+        sample_bytes = (size_t)runner->sample_capacity * sizeof(uint64_t);
+
+        /* mlock both locks and prefaults; failure (e.g. RLIMIT_MEMLOCK)
+         * downgrades to prefault-only — recorded in the result */
+        if (input_size > 0 && mlock(input, input_size) != 0) {
+            locked = false;
+        }
+        if (output_size > 0 && mlock(output, output_size) != 0) {
+            locked = false;
+        }
+        if (mlock(runner->samples, sample_bytes) != 0) {
+            locked = false;
+        }
+        runner->isolation_mlock = locked;
+
+        /* Prefault regardless, so first-touch faults cannot land inside
+         * the critical loop. Output and samples are scratch at this
+         * point; input is touched read-only. */
+        memset(runner->samples, 0, sample_bytes);
+        if (output_size > 0) {
+            memset(output, 0, output_size);
+        }
+        if (input_size > 0) {
+            const volatile uint8_t *page = (const volatile uint8_t *)input;
+            uint32_t off;
+            for (off = 0; off < input_size; off += 4096U) {
+                (void)page[off];
+            }
+            (void)page[input_size - 1U];
+        }
+    }
+
+    if (runner->config.isolate_priority) {
+        struct sched_param sp;
+        memset(&sp, 0, sizeof(sp));
+        sp.sched_priority = 1;
+        /* Needs CAP_SYS_NICE — best effort */
+        runner->isolation_priority = (sched_setscheduler(0, SCHED_FIFO, &sp) == 0);
+    }
+
+    return CB_OK;
+#else
+    /* No isolation primitives on this platform — the result records the
+     * phase as inactive */
+    (void)runner;
+    (void)input;
+    (void)input_size;
+    (void)output;
+    (void)output_size;
+    return CB_OK;
+#endif
+}
+
 /**
  * @brief Execute warmup phase
  * @satisfies RUNNER-F-011, RUNNER-F-030 through RUNNER-F-033
@@ -192,6 +349,15 @@ cb_result_code_t cb_runner_warmup(cb_runner_t *runner,
 {
     uint32_t i;
     cb_result_code_t rc;
+    uint32_t window;
+    uint32_t in_window = 0;
+    uint64_t window_sum = 0;
+    uint64_t prev_mean = 0;
+    uint64_t t0;
+    uint64_t mean;
+    uint64_t drift;
+    uint64_t phase_start;
+    bool converged = false;
 
     (void)input_size;  /* Used for documentation, may be used in future */
     (void)output_size; /* Used for documentation, may be used in future */
@@ -210,16 +376,71 @@ cb_result_code_t cb_runner_warmup(cb_runner_t *runner,
         return CB_ERR_INVALID_CONFIG;
     }
 
-    /* RUNNER-F-030: Warmup executes same inference path as measurement */
-    /* RUNNER-F-031: Warmup does NOT record timing */
-    for (i = 0; i < runner->config.warmup_iterations; i++) {
-        rc = fn(ctx, input, output);
+    /* §4.12: the whole warmup phase, isolation setup included, is
+     * charged to overhead.warmup_ns */
+    phase_start = cb_timer_now_ns();
+
+    /* Opt-in isolation phase (SRS-003-RUNNER §4.9): applied before the
+     * first warmup call so pinning and prefaulting precede all work */
+    if (runner->config.isolate) {
+        rc = apply_isolation(runner, input, input_size, output, output_size);
         if (rc != CB_OK) {
-            /* RUNNER-F-033: Warmup failure aborts benchmark */
             return rc;
         }
     }
 
+    /* RUNNER-F-030: Warmup executes same inference path as measurement */
+    /* RUNNER-F-031: Warmup does NOT record timing in the sample buffer */
+    if (runner->config.adaptive_warmup) {
+        /* Steady-state detection (§4.3): consecutive rolling-window
+         * means are compared, and warmup ends once their relative drift
+         * falls below warmup_drift_q16 — cache and branch-predictor
+         * state is taken as converged at that point. warmup_iterations
+         * remains the hard cap, so a host that never settles behaves
+         * exactly as in fixed mode. Per-call timing here uses the
+         * portable nanosecond clock: warmup is never measured, so the
+         * critical-loop discipline (CB-MATH-001 §7.2) does not apply. */
+        window = (runner->config.warmup_window > 0U)
+                     ? runner->config.warmup_window : 16U;
+
+        for (i = 0; i < runner->config.warmup_iterations && !converged; i++) {
+            t0 = cb_timer_now_ns();
+            rc = fn(ctx, input, output);
+            if (rc != CB_OK) {
+                /* RUNNER-F-033: Warmup failure aborts benchmark */
+                return rc;
+            }
+            window_sum += cb_timer_now_ns() - t0;
+
+            in_window++;
+            if (in_window == window) {
+                mean = window_sum / window;
+                if (prev_mean > 0) {
+                    drift = (mean > prev_mean) ? (mean - prev_mean)
+                                               : (prev_mean - mean);
+                    if (drift <= (UINT64_MAX >> 16) &&
+                        ((drift << 16) / prev_mean) <=
+                            (uint64_t)runner->config.warmup_drift_q16) {
+                        converged = true;
+                    }
+                }
+                prev_mean = mean;
+                window_sum = 0;
+                in_window = 0;
+            }
+        }
+        runner->warmup_consumed = i;
+    } else {
+        for (i = 0; i < runner->config.warmup_iterations; i++) {
+            rc = fn(ctx, input, output);
+            if (rc != CB_OK) {
+                /* RUNNER-F-033: Warmup failure aborts benchmark */
+                return rc;
+            }
+        }
+        runner->warmup_consumed = runner->config.warmup_iterations;
+    }
+
     /* Capture environment at end of warmup (start of measurement) */
     if (runner->config.monitor_environment) {
         cb_env_snapshot(&runner->env_start);
@@ -227,11 +448,140 @@ cb_result_code_t cb_runner_warmup(cb_runner_t *runner,
 
     /* Record benchmark start time */
     runner->benchmark_start_ns = cb_timer_now_ns();
+    runner->overhead.warmup_ns = runner->benchmark_start_ns - phase_start;
 
     runner->warmup_complete = true;
     return CB_OK;
 }
 
+/**
+ * @brief Relative CI half-width of the mean in Q16.16 (CB-MATH-001 §6.9)
+ *
+ * Half-width ≈ 2·stddev/√n (z = 2, slightly wider than 1.96 for 95%),
+ * expressed relative to the mean. The ratio is scale-invariant, so it
+ * can be evaluated on raw cycle deltas during the run — no per-sample
+ * ns conversion needed. Floor square roots make the estimate
+ * conservative: it never reports tighter precision than achieved.
+ *
+ * @param welford_m Running integer Welford mean (raw units)
+ * @param welford_s Running sum of squared deviations
+ * @param count     Samples accumulated
+ * @return Relative half-width in Q16.16, UINT32_MAX if undefined
+ */
+static uint32_t ci_rel_half_width_q16(int64_t welford_m,
+                                      int64_t welford_s,
+                                      uint64_t count)
+{
+    uint64_t variance, stddev, sqrt_n, denom, rel;
+
+    if (count < 2 || welford_m <= 0 || welford_s < 0) {
+        return UINT32_MAX;
+    }
+
+    variance = (uint64_t)(welford_s / (int64_t)(count - 1));
+    stddev = cb_isqrt64(variance);
+    sqrt_n = cb_isqrt64(count);
+    if (sqrt_n == 0) {
+        return UINT32_MAX;
+    }
+
+    denom = (uint64_t)welford_m * sqrt_n;
+
+    /* rel_q16 = (2·stddev << 16) / (mean·√n) */
+    if (stddev > (UINT64_MAX >> 17)) {
+        return UINT32_MAX;
+    }
+    rel = (stddev << 17) / denom;
+
+    return (rel > UINT32_MAX) ? UINT32_MAX : (uint32_t)rel;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Outlier Forensics (SRS-003-RUNNER §4.15)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Smallest raw timer delta meeting the forensic threshold
+ *
+ * The hot loop holds raw (unconverted) deltas, so the nanosecond
+ * threshold is translated once into raw units by binary search over
+ * the monotone cb_cycles_to_ns() mapping — the per-iteration forensic
+ * check is then a single integer compare. With timing_batch > 1 each
+ * stored delta covers k calls, so the per-call threshold scales by k.
+ *
+ * @param threshold_ns Per-call latency threshold
+ * @param k            Calls per timestamp pair
+ * @return Smallest raw delta whose converted value meets the threshold
+ */
+static uint64_t forensic_threshold_raw(uint64_t threshold_ns, uint32_t k)
+{
+    uint64_t target, lo, hi, mid;
+
+    if (threshold_ns > UINT64_MAX / k) {
+        return UINT64_MAX;
+    }
+    target = threshold_ns * k;
+
+    lo = 0;
+    hi = UINT64_MAX;
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2U;
+        if (cb_cycles_to_ns(mid) >= target) {
+            hi = mid;
+        } else {
+            lo = mid + 1U;
+        }
+    }
+    return lo;
+}
+
+/**
+ * @brief Record forensic context for one tail sample
+ *
+ * Cold path — runs only when a sample crossed the threshold, outside
+ * the critical section. Snapshots the hardware counter group (deltas
+ * against the previous capture) and the environment into the next
+ * ring slot; once the ring is full the oldest records are
+ * overwritten, keeping the most recent tail events.
+ *
+ * @param runner     Runner with forensics configured
+ * @param iteration  Index of the slow sample
+ * @param latency_ns Per-call latency of the sample
+ */
+static void forensic_capture(cb_runner_t *runner,
+                             uint32_t iteration,
+                             uint64_t latency_ns)
+{
+    cb_forensic_t *slot;
+    cb_hwcounters_t now;
+
+    slot = &runner->config.forensic_ring[
+        runner->forensic_captured % runner->config.forensic_capacity];
+    slot->iteration = iteration;
+    slot->_padding = 0;
+    slot->latency_ns = latency_ns;
+
+    /* Counter deltas are zero when no group is running */
+    if (cb_hwcounters_read(&now) == CB_OK) {
+        slot->cycles = now.cycles - runner->forensic_base.cycles;
+        slot->instructions =
+            now.instructions - runner->forensic_base.instructions;
+        slot->cache_misses =
+            now.cache_misses - runner->forensic_base.cache_misses;
+        runner->forensic_base = now;
+    } else {
+        slot->cycles = 0;
+        slot->instructions = 0;
+        slot->cache_misses = 0;
+    }
+
+    if (cb_env_snapshot(&slot->env) != CB_OK) {
+        memset(&slot->env, 0, sizeof(slot->env));
+    }
+
+    runner->forensic_captured++;
+}
+
 /**
  * @brief Execute measurement phase
  *
@@ -248,8 +598,22 @@ cb_result_code_t cb_runner_execute(cb_runner_t *runner,
                                     uint32_t output_size)
 {
     uint32_t i;
+    uint32_t k;
     uint64_t t_start, t_end;
+    uint64_t t_verify, t_iter;
+    uint64_t timed_raw = 0;
+    uint64_t verify_raw = 0;
+    uint64_t stats_raw = 0;
+    uint64_t phase_start, phase_end, t_convert;
+    cb_timer_fast_t fast;
     cb_result_code_t rc;
+    bool adaptive;
+    bool cold;
+    bool forensics;
+    uint64_t forensic_raw = 0;
+    uint32_t ci_check, ci_min;
+    int64_t ci_m = 0;
+    int64_t ci_s = 0;
 
     if (runner == NULL || fn == NULL) {
         return CB_ERR_NULL_PTR;
@@ -273,31 +637,342 @@ cb_result_code_t cb_runner_execute(cb_runner_t *runner,
         }
     }
 
+    /* Timing granularity: calls per timestamp pair (0 treated as 1) */
+    k = (runner->config.timing_batch > 1U) ? runner->config.timing_batch : 1U;
+
+    /* Adaptive stopping (§4.11): sequential CI checks on raw deltas */
+    adaptive = runner->config.adaptive_stop;
+    ci_check = (runner->config.ci_check_interval > 0U)
+                   ? runner->config.ci_check_interval : 256U;
+    ci_min = runner->config.ci_min_iterations;
+
+    /* Cold-cache mode (§4.14) */
+    cold = runner->config.cold_cache;
+
+    /* Outlier forensics (§4.15): precompute the raw-unit threshold and
+     * take the counter baseline the first capture will delta against */
+    forensics = (runner->config.forensic_threshold_ns > 0);
+    if (forensics) {
+        forensic_raw =
+            forensic_threshold_raw(runner->config.forensic_threshold_ns, k);
+        (void)cb_hwcounters_read(&runner->forensic_base);
+    }
+
+    /* Resolve the timer backend once — the hot loop uses the inline
+     * fast-path read (raw units) and ns conversion is deferred */
+    if (cb_timer_fast_init(&fast) != CB_OK) {
+        return CB_ERR_TIMER_INIT;
+    }
+
+    /* §4.12: phase accounting (CB-MATH-001 §7.2). Per-iteration phase
+     * boundaries reuse timestamps the loop already takes where
+     * possible; the one extra fast-path read at the bottom of each
+     * iteration sits outside the critical section, so the accounting
+     * itself never perturbs the measured region. */
+    phase_start = cb_timer_now_ns();
+
     /* RUNNER-F-012: Measurement loop - warmup NOT included in results */
     for (i = 0; i < runner->config.measure_iterations; i++) {
+        /* §4.14: cold-cache preconditioning — flush the working set
+         * BEFORE the timed region so each sample observes cold caches
+         * without the flush cost itself being measured. The flush time
+         * lands in the residual of the overhead record (§4.12). */
+        if (cold) {
+            if (input_size > 0) {
+                cb_cache_flush_range(input, input_size);
+            }
+            if (output_size > 0) {
+                cb_cache_flush_range(output, output_size);
+            }
+            if (runner->config.cold_flush_size > 0) {
+                cb_cache_flush_range(runner->config.cold_flush_base,
+                                     runner->config.cold_flush_size);
+            }
+        }
+
         /*═══════════════════════════════════════════════════════════════════
          * CRITICAL LOOP START (RUNNER-F-020)
-         * Only timer reads and inference call inside this section.
+         * Only timer reads and inference calls inside this section. The
+         * fast-path read is the bare serialised counter instruction;
+         * raw deltas are converted to ns after the loop. With
+         * timing_batch > 1, k back-to-back calls share one timestamp
+         * pair so the timer's calibration overhead is amortized across
+         * the group — essential for sub-microsecond kernels where the
+         * timer would otherwise dominate the measurement.
          *═══════════════════════════════════════════════════════════════════*/
-        t_start = cb_timer_now_ns();                    /* RUNNER-F-016 */
-        rc = fn(ctx, input, output);                    /* Inference */
-        t_end = cb_timer_now_ns();                      /* RUNNER-F-016 */
+        t_start = cb_timer_fast_read(&fast);            /* RUNNER-F-016 */
+        if (k == 1U) {
+            rc = fn(ctx, input, output);                /* Inference */
+        } else {
+            uint32_t j;
+            for (j = 0; j < k; j++) {
+                rc = fn(ctx, input, output);            /* Inference ×k */
+            }
+        }
+        t_end = cb_timer_fast_read(&fast);              /* RUNNER-F-016 */
         /*═══════════════════════════════════════════════════════════════════
          * CRITICAL LOOP END
          *═══════════════════════════════════════════════════════════════════*/
 
-        /* Store sample (RUNNER-F-013) */
+        /* Store raw delta (RUNNER-F-013); converted below */
         runner->samples[i] = t_end - t_start;
+        timed_raw += t_end - t_start;
 
         /* Check for timer wraparound */
         if (t_end < t_start) {
             runner->faults.timer_error = 1;
         }
 
-        /* RUNNER-F-022: Verification OUTSIDE critical loop */
+        /* RUNNER-F-022: Verification OUTSIDE critical loop. In batched
+         * mode the calls within a group overwrite one output buffer, so
+         * one representative output per group is hashed — determinism
+         * failures within a group still perturb the final call. */
         if (runner->config.verify_outputs && output_size > 0) {
             cb_verify_ctx_update(&runner->verify_ctx, output, output_size);
+            t_verify = cb_timer_fast_read(&fast);
+            verify_raw += t_verify - t_end;
+        } else {
+            t_verify = t_end;
+        }
+
+        /* RUNNER-F-074: Continue even if inference fails (collect timing data) */
+        if (rc != CB_OK) {
+            runner->faults.verify_fail = 1;
+        }
+
+        /* §4.15: forensic capture for tail samples, outside the
+         * critical section. Non-outlier iterations pay one compare
+         * against the precomputed raw threshold — the distribution
+         * itself is undisturbed. */
+        if (forensics && t_end - t_start >= forensic_raw) {
+            forensic_capture(runner, i, cb_cycles_to_ns(t_end - t_start) / k);
+        }
+
+        /* §4.11: sequential CI check, outside the timed region. The
+         * Welford update runs on raw deltas — the relative half-width
+         * is scale-invariant, so deferred ns conversion is preserved */
+        if (adaptive) {
+            int64_t delta = (int64_t)runner->samples[i] - ci_m;
+            ci_m += delta / (int64_t)(i + 1U);
+            ci_s += delta * ((int64_t)runner->samples[i] - ci_m);
+
+            if (i + 1U >= ci_min && ((i + 1U) % ci_check) == 0U) {
+                runner->ci_achieved_q16 =
+                    ci_rel_half_width_q16(ci_m, ci_s, i + 1U);
+                if (runner->ci_achieved_q16 <= runner->config.ci_rel_q16) {
+                    runner->stopped_early = true;
+                    i++;
+                    break;
+                }
+            }
+        }
+
+        /* §4.12: sample store, fault checks and Welford/CI updates are
+         * charged to stats */
+        t_iter = cb_timer_fast_read(&fast);
+        stats_raw += t_iter - t_verify;
+    }
+
+    runner->samples_collected = i;
+
+    /* Record the precision actually achieved when the cap was reached
+     * before the target (stopped_early false, achieved > target) */
+    if (adaptive && !runner->stopped_early) {
+        runner->ci_achieved_q16 =
+            ci_rel_half_width_q16(ci_m, ci_s, runner->samples_collected);
+    }
+
+    /* Deferred conversion: raw deltas → per-call nanoseconds (identity
+     * scale on the POSIX backend). Batched samples are recorded as
+     * per-call means so the stats layer needs no special handling. */
+    t_convert = cb_timer_now_ns();
+    for (i = 0; i < runner->samples_collected; i++) {
+        runner->samples[i] = cb_cycles_to_ns(runner->samples[i]) / k;
+    }
+
+    /* §4.12: fold the phase counters into the result-visible overhead
+     * record. The deferred ns conversion above is stats work; the raw
+     * cycle accumulators convert once here, not per iteration. */
+    phase_end = cb_timer_now_ns();
+    runner->overhead.timed_ns = cb_cycles_to_ns(timed_raw);
+    runner->overhead.verify_ns = cb_cycles_to_ns(verify_raw);
+    runner->overhead.stats_ns =
+        cb_cycles_to_ns(stats_raw) + (phase_end - t_convert);
+    runner->overhead.total_ns =
+        runner->overhead.warmup_ns + (phase_end - phase_start);
+
+    return CB_OK;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Pipelined Verification (SRS-003-RUNNER §4.8)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Shared state between the measurement loop and the hash worker
+ *
+ * Two output slots alternate between the producer (measurement loop)
+ * and the consumer (verification worker). A slot marked full holds an
+ * output awaiting hashing; the producer never writes a full slot, so
+ * the consumer can hash without holding the lock.
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t can_produce;
+    pthread_cond_t can_consume;
+    void *slots[2];
+    uint32_t output_size;
+    int slot_full[2];
+    uint32_t head;              /* Next slot the consumer will hash */
+    bool done;
+    cb_verify_ctx_t *verify_ctx;
+} pipeline_state_t;
+
+/**
+ * @brief Verification worker: hash slots strictly in iteration order
+ */
+static void *pipeline_verify_main(void *arg)
+{
+    pipeline_state_t *pipe = (pipeline_state_t *)arg;
+
+    for (;;) {
+        pthread_mutex_lock(&pipe->lock);
+        while (!pipe->slot_full[pipe->head] && !pipe->done) {
+            pthread_cond_wait(&pipe->can_consume, &pipe->lock);
+        }
+        if (!pipe->slot_full[pipe->head] && pipe->done) {
+            pthread_mutex_unlock(&pipe->lock);
+            break;
+        }
+        pthread_mutex_unlock(&pipe->lock);
+
+        /* Hash outside the lock — producer is busy with the other slot */
+        cb_verify_ctx_update(pipe->verify_ctx,
+                             pipe->slots[pipe->head], pipe->output_size);
+
+        pthread_mutex_lock(&pipe->lock);
+        pipe->slot_full[pipe->head] = 0;
+        pipe->head ^= 1U;
+        pthread_cond_signal(&pipe->can_produce);
+        pthread_mutex_unlock(&pipe->lock);
+    }
+
+    return NULL;
+}
+
+cb_result_code_t cb_runner_execute_pipelined(cb_runner_t *runner,
+                                             cb_inference_fn fn,
+                                             void *ctx,
+                                             const void *input,
+                                             uint32_t input_size,
+                                             void *output_a,
+                                             void *output_b,
+                                             uint32_t output_size)
+{
+    pipeline_state_t pipe;
+    pthread_t verifier;
+    uint32_t i;
+    uint64_t t_start, t_end;
+    cb_timer_fast_t fast;
+    cb_result_code_t rc;
+
+    if (runner == NULL || fn == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    /* Without verification there is nothing to overlap — synchronous path.
+     * Batched timing groups overwrite one buffer per timestamp pair, so
+     * it also takes the synchronous path (one hash per group), as does
+     * adaptive stopping (the pipelined loop runs a fixed count) and
+     * cold-cache mode (§4.14: the per-iteration flushes happen only in
+     * the synchronous loop — running pipelined would label warm-path
+     * samples as cold-start). */
+    if (!runner->config.verify_outputs || output_size == 0 ||
+        runner->config.timing_batch > 1U || runner->config.adaptive_stop ||
+        runner->config.cold_cache) {
+        return cb_runner_execute(runner, fn, ctx, input, input_size,
+                                 output_a, output_size);
+    }
+
+    if (output_a == NULL || output_b == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (input == NULL && input_size > 0) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    if (!runner->initialised) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* Run warmup if not already done (uses buffer A) */
+    if (!runner->warmup_complete) {
+        rc = cb_runner_warmup(runner, fn, ctx, input, input_size,
+                              output_a, output_size);
+        if (rc != CB_OK) {
+            return rc;
         }
+    }
+
+    if (cb_timer_fast_init(&fast) != CB_OK) {
+        return CB_ERR_TIMER_INIT;
+    }
+
+    pthread_mutex_init(&pipe.lock, NULL);
+    pthread_cond_init(&pipe.can_produce, NULL);
+    pthread_cond_init(&pipe.can_consume, NULL);
+    pipe.slots[0] = output_a;
+    pipe.slots[1] = output_b;
+    pipe.output_size = output_size;
+    pipe.slot_full[0] = 0;
+    pipe.slot_full[1] = 0;
+    pipe.head = 0;
+    pipe.done = false;
+    pipe.verify_ctx = &runner->verify_ctx;
+
+    if (pthread_create(&verifier, NULL, pipeline_verify_main, &pipe) != 0) {
+        pthread_cond_destroy(&pipe.can_consume);
+        pthread_cond_destroy(&pipe.can_produce);
+        pthread_mutex_destroy(&pipe.lock);
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    for (i = 0; i < runner->config.measure_iterations; i++) {
+        uint32_t slot = i & 1U;
+        void *output = pipe.slots[slot];
+
+        /* Wait until the verifier has drained this slot — outside the
+         * timed region, so pipeline stalls never pollute samples */
+        pthread_mutex_lock(&pipe.lock);
+        while (pipe.slot_full[slot]) {
+            pthread_cond_wait(&pipe.can_produce, &pipe.lock);
+        }
+        pthread_mutex_unlock(&pipe.lock);
+
+        /*═══════════════════════════════════════════════════════════════════
+         * CRITICAL LOOP START (RUNNER-F-020)
+         * Only timer reads and inference call inside this section.
+         *═══════════════════════════════════════════════════════════════════*/
+        t_start = cb_timer_fast_read(&fast);            /* RUNNER-F-016 */
+        rc = fn(ctx, input, output);                    /* Inference */
+        t_end = cb_timer_fast_read(&fast);              /* RUNNER-F-016 */
+        /*═══════════════════════════════════════════════════════════════════
+         * CRITICAL LOOP END
+         *═══════════════════════════════════════════════════════════════════*/
+
+        /* Store raw delta (RUNNER-F-013); converted after the loop */
+        runner->samples[i] = t_end - t_start;
+
+        /* Check for timer wraparound */
+        if (t_end < t_start) {
+            runner->faults.timer_error = 1;
+        }
+
+        /* Hand the filled slot to the verification worker */
+        pthread_mutex_lock(&pipe.lock);
+        pipe.slot_full[slot] = 1;
+        pthread_cond_signal(&pipe.can_consume);
+        pthread_mutex_unlock(&pipe.lock);
 
         /* RUNNER-F-074: Continue even if inference fails (collect timing data) */
         if (rc != CB_OK) {
@@ -305,6 +980,22 @@ cb_result_code_t cb_runner_execute(cb_runner_t *runner,
         }
     }
 
+    /* Drain the pipeline and join the worker */
+    pthread_mutex_lock(&pipe.lock);
+    pipe.done = true;
+    pthread_cond_signal(&pipe.can_consume);
+    pthread_mutex_unlock(&pipe.lock);
+    pthread_join(verifier, NULL);
+
+    pthread_cond_destroy(&pipe.can_consume);
+    pthread_cond_destroy(&pipe.can_produce);
+    pthread_mutex_destroy(&pipe.lock);
+
+    /* Deferred conversion: raw deltas → nanoseconds */
+    for (i = 0; i < runner->config.measure_iterations; i++) {
+        runner->samples[i] = cb_cycles_to_ns(runner->samples[i]);
+    }
+
     runner->samples_collected = runner->config.measure_iterations;
 
     return CB_OK;
@@ -343,6 +1034,10 @@ cb_result_code_t cb_runner_get_result(const cb_runner_t *runner,
     result->warmup_iterations = runner->config.warmup_iterations;
     result->measure_iterations = runner->config.measure_iterations;
     result->batch_size = runner->config.batch_size;
+    result->timing_batch = (runner->config.timing_batch > 1U)
+                               ? runner->config.timing_batch : 1U;
+    result->cold_cache = runner->config.cold_cache;  /* §4.14 */
+    result->streaming = runner->throughput_measured; /* §4.16 */
 
     /* RUNNER-F-042, RUNNER-F-023: Compute statistics AFTER all iterations */
     cb_fault_clear(&stats_faults);
@@ -351,24 +1046,31 @@ cb_result_code_t cb_runner_get_result(const cb_runner_t *runner,
     cb_compute_stats(runner->samples, runner->samples_collected,
                      &result->latency, &stats_faults);
 
-    /* RUNNER-F-043, RUNNER-F-050, RUNNER-F-051: Throughput calculation */
-    /* Total latency = sum of all samples */
-    total_latency_ns = 0;
-    for (i = 0; i < runner->samples_collected; i++) {
-        total_latency_ns += runner->samples[i];
-    }
+    /* RUNNER-F-043, RUNNER-F-050, RUNNER-F-051: Throughput calculation.
+     * Streaming runs (§4.16) report the sustained rates measured over
+     * the streaming phase; otherwise throughput is derived from the
+     * summed sample latencies as before. */
+    if (runner->throughput_measured) {
+        result->throughput = runner->measured_throughput;
+    } else {
+        /* Total latency = sum of all samples */
+        total_latency_ns = 0;
+        for (i = 0; i < runner->samples_collected; i++) {
+            total_latency_ns += runner->samples[i];
+        }
 
-    /* RUNNER-F-050: inferences_per_sec = (iterations × 10^9) / total_latency_ns */
-    if (total_latency_ns > 0) {
-        result->throughput.inferences_per_sec =
-            ((uint64_t)runner->samples_collected * CB_NS_PER_SEC) / total_latency_ns;
-    }
+        /* RUNNER-F-050: inferences_per_sec = (iterations × 10^9) / total_latency_ns */
+        if (total_latency_ns > 0) {
+            result->throughput.inferences_per_sec =
+                ((uint64_t)runner->samples_collected * CB_NS_PER_SEC) / total_latency_ns;
+        }
 
-    /* RUNNER-F-051: samples_per_sec = inferences_per_sec × batch_size */
-    result->throughput.samples_per_sec =
-        result->throughput.inferences_per_sec * runner->config.batch_size;
+        /* RUNNER-F-051: samples_per_sec = inferences_per_sec × batch_size */
+        result->throughput.samples_per_sec =
+            result->throughput.inferences_per_sec * runner->config.batch_size;
 
-    result->throughput.batch_size = runner->config.batch_size;
+        result->throughput.batch_size = runner->config.batch_size;
+    }
 
     /* Environment data */
     if (runner->config.monitor_environment) {
@@ -382,6 +1084,28 @@ cb_result_code_t cb_runner_get_result(const cb_runner_t *runner,
         }
     }
 
+    /* Isolation state (SRS-003-RUNNER §4.9) */
+    result->isolation_active = runner->isolation_active;
+    result->isolation_mlock = runner->isolation_mlock;
+    result->isolation_priority = runner->isolation_priority;
+    result->isolation_core = runner->isolation_core;
+
+    /* Adaptive stopping state (SRS-003-RUNNER §4.11) */
+    result->adaptive_stop = runner->config.adaptive_stop;
+    result->stopped_early = runner->stopped_early;
+    result->ci_achieved_q16 = runner->ci_achieved_q16;
+
+    /* Adaptive warmup state (SRS-003-RUNNER §4.3) */
+    result->warmup_consumed = runner->warmup_consumed;
+
+    /* Overhead accounting (SRS-003-RUNNER §4.12, CB-MATH-001 §7.2) */
+    result->overhead = runner->overhead;
+
+    /* Outlier forensics (SRS-003-RUNNER §4.15) */
+    result->forensic_ring = runner->config.forensic_ring;
+    result->forensic_captured = runner->forensic_captured;
+    result->forensic_capacity = runner->config.forensic_capacity;
+
     /* RUNNER-F-044: Benchmark duration */
     result->benchmark_start_ns = runner->benchmark_start_ns;
     result->benchmark_end_ns = cb_timer_now_ns();
@@ -435,6 +1159,609 @@ void cb_runner_cleanup(cb_runner_t *runner)
     runner->samples_collected = 0;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Streaming Throughput (SRS-003-RUNNER §4.16)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/** Bytes of the next record prefetched ahead of each inference */
+#define STREAM_PREFETCH_MAX 4096U
+
+/** Prefetch granularity (one cache line) */
+#define STREAM_PREFETCH_LINE 64U
+
+/**
+ * @brief Hint the next record into cache while this one is inferred
+ *
+ * Issues non-blocking prefetch hints over the leading cache lines of
+ * the next input; the loads proceed in the background while the
+ * current inference computes. Capped at STREAM_PREFETCH_MAX so large
+ * records do not turn the hint loop into measurable work.
+ */
+static void stream_prefetch(const void *ptr, uint32_t size)
+{
+    const char *p = (const char *)ptr;
+    uint32_t span = (size < STREAM_PREFETCH_MAX) ? size : STREAM_PREFETCH_MAX;
+    uint32_t off;
+
+    for (off = 0; off < span; off += STREAM_PREFETCH_LINE) {
+        __builtin_prefetch(p + off, 0, 3);
+    }
+}
+
+/**
+ * @brief Scale a count to a per-second rate over a wall-clock interval
+ *
+ * rate = count × 10⁹ / wall_ns, split like cycles_to_ns() to avoid
+ * 64-bit overflow; intervals beyond ~18 s fall back to whole-second
+ * precision rather than wrapping.
+ *
+ * @param count   Events (or bytes) observed during the interval
+ * @param wall_ns Interval length in nanoseconds
+ * @return Events per second (0 if wall_ns is 0)
+ */
+static uint64_t rate_per_sec(uint64_t count, uint64_t wall_ns)
+{
+    uint64_t whole, rem;
+
+    if (wall_ns == 0) {
+        return 0;
+    }
+
+    whole = count / wall_ns;
+    rem = count % wall_ns;
+
+    if (whole > UINT64_MAX / CB_NS_PER_SEC) {
+        return UINT64_MAX;
+    }
+    if (rem > UINT64_MAX / CB_NS_PER_SEC) {
+        /* wall_ns > ~18 s here, so the divisor is at least 18 */
+        return count / (wall_ns / CB_NS_PER_SEC);
+    }
+
+    return whole * CB_NS_PER_SEC + (rem * CB_NS_PER_SEC) / wall_ns;
+}
+
+/**
+ * @brief Execute measurement phase streaming over a mapped corpus
+ * @satisfies RUNNER-F-100 through RUNNER-F-104
+ */
+cb_result_code_t cb_runner_execute_streaming(cb_runner_t *runner,
+                                             cb_inference_fn fn,
+                                             void *ctx,
+                                             const cb_data_map_t *map,
+                                             uint32_t record_size,
+                                             uint32_t stride,
+                                             bool prefetch,
+                                             void *output,
+                                             uint32_t output_size)
+{
+    uint32_t i;
+    uint64_t t_start, t_end;
+    uint64_t wall_start, wall_end, wall_ns;
+    uint64_t num_records, index, next_index;
+    const void *input;
+    const void *next_input;
+    cb_timer_fast_t fast;
+    cb_result_code_t rc;
+
+    if (runner == NULL || fn == NULL || map == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (output == NULL && output_size > 0) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (!runner->initialised) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+    if (record_size == 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* Cold-cache mode (§4.14) does not combine with streaming: this
+     * loop performs no per-iteration flushes, so accepting the flag
+     * would label warm-path samples as cold-start */
+    if (runner->config.cold_cache) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    num_records = cb_data_num_records(map, record_size);
+    if (num_records == 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* Stride in records per iteration (0 treated as 1) */
+    if (stride == 0) {
+        stride = 1;
+    }
+
+    /* Warmup on the first record if not already done */
+    rc = cb_data_slice(map, 0, record_size, &input);
+    if (rc != CB_OK) {
+        return rc;
+    }
+    if (!runner->warmup_complete) {
+        rc = cb_runner_warmup(runner, fn, ctx, input, record_size,
+                              output, output_size);
+        if (rc != CB_OK) {
+            return rc;
+        }
+    }
+
+    if (cb_timer_fast_init(&fast) != CB_OK) {
+        return CB_ERR_TIMER_INIT;
+    }
+
+    /* RUNNER-F-101: each iteration advances stride records through
+     * the corpus, wrapping at the end, so the cache pressure of real
+     * input traffic is present in the measurement — nothing is
+     * artificially re-fed from a hot buffer. */
+    index = 0;
+    wall_start = cb_timer_now_ns();
+    for (i = 0; i < runner->config.measure_iterations; i++) {
+        next_index = (index + stride) % num_records;
+        (void)cb_data_slice(map, next_index, record_size, &next_input);
+
+        /*═══════════════════════════════════════════════════════════════════
+         * CRITICAL LOOP START (RUNNER-F-020)
+         * The optional prefetch hint for iteration i+1's input is
+         * deliberately inside the timed region: it is part of the
+         * streaming pipeline being measured, and the non-blocking
+         * loads overlap the inference that follows.
+         *═══════════════════════════════════════════════════════════════════*/
+        t_start = cb_timer_fast_read(&fast);
+        if (prefetch) {
+            stream_prefetch(next_input, record_size);
+        }
+        rc = fn(ctx, input, output);
+        t_end = cb_timer_fast_read(&fast);
+        /*═══════════════════════════════════════════════════════════════════
+         * CRITICAL LOOP END
+         *═══════════════════════════════════════════════════════════════════*/
+
+        runner->samples[i] = t_end - t_start;
+        if (t_end < t_start) {
+            runner->faults.timer_error = 1;
+        }
+
+        /* RUNNER-F-022: verification outside the critical loop */
+        if (runner->config.verify_outputs && output_size > 0) {
+            cb_verify_ctx_update(&runner->verify_ctx, output, output_size);
+        }
+        if (rc != CB_OK) {
+            runner->faults.verify_fail = 1;
+        }
+
+        input = next_input;
+        index = next_index;
+    }
+    wall_end = cb_timer_now_ns();
+
+    runner->samples_collected = runner->config.measure_iterations;
+
+    /* Deferred conversion, as in cb_runner_execute() */
+    for (i = 0; i < runner->samples_collected; i++) {
+        runner->samples[i] = cb_cycles_to_ns(runner->samples[i]);
+    }
+
+    /* RUNNER-F-102, RUNNER-F-103: sustained rates are measured over
+     * the wall clock of the whole streaming phase — input advance and
+     * verification included — not derived from summed sample
+     * latencies. bytes_per_sec is the input traffic actually streamed. */
+    wall_ns = wall_end - wall_start;
+    runner->measured_throughput.inferences_per_sec =
+        rate_per_sec(runner->samples_collected, wall_ns);
+    runner->measured_throughput.samples_per_sec =
+        runner->measured_throughput.inferences_per_sec *
+        runner->config.batch_size;
+    runner->measured_throughput.bytes_per_sec =
+        rate_per_sec((uint64_t)runner->samples_collected * record_size,
+                     wall_ns);
+    runner->measured_throughput.batch_size = runner->config.batch_size;
+    runner->throughput_measured = true;
+
+    return CB_OK;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Interleaved A/B Execution (SRS-003-RUNNER §4.10)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Run one block of measured iterations for one variant
+ *
+ * Same critical-loop discipline as cb_runner_execute(): only timer
+ * reads and inference calls inside the timed region, raw deltas
+ * stored for deferred conversion, verification between iterations.
+ *
+ * @param runner      Variant's runner (warmup complete)
+ * @param fn          Variant's inference function
+ * @param ctx         Variant's context
+ * @param input       Variant's input buffer
+ * @param output      Variant's output buffer
+ * @param output_size Output buffer size
+ * @param fast        Resolved fast-path timer handle
+ * @param start       First iteration index of this block
+ * @param count       Iterations in this block
+ */
+static void execute_block(cb_runner_t *runner,
+                          cb_inference_fn fn,
+                          void *ctx,
+                          const void *input,
+                          void *output,
+                          uint32_t output_size,
+                          const cb_timer_fast_t *fast,
+                          uint32_t start,
+                          uint32_t count)
+{
+    uint64_t t_start, t_end;
+    cb_result_code_t rc;
+    uint32_t k;
+    uint32_t i;
+
+    k = (runner->config.timing_batch > 1U) ? runner->config.timing_batch : 1U;
+
+    for (i = start; i < start + count; i++) {
+        /*═══════════════════════════════════════════════════════════════════
+         * CRITICAL LOOP START (RUNNER-F-020)
+         *═══════════════════════════════════════════════════════════════════*/
+        t_start = cb_timer_fast_read(fast);
+        if (k == 1U) {
+            rc = fn(ctx, input, output);
+        } else {
+            uint32_t j;
+            for (j = 0; j < k; j++) {
+                rc = fn(ctx, input, output);
+            }
+        }
+        t_end = cb_timer_fast_read(fast);
+        /*═══════════════════════════════════════════════════════════════════
+         * CRITICAL LOOP END
+         *═══════════════════════════════════════════════════════════════════*/
+
+        runner->samples[i] = t_end - t_start;
+
+        if (t_end < t_start) {
+            runner->faults.timer_error = 1;
+        }
+
+        if (runner->config.verify_outputs && output_size > 0) {
+            cb_verify_ctx_update(&runner->verify_ctx, output, output_size);
+        }
+
+        if (rc != CB_OK) {
+            runner->faults.verify_fail = 1;
+        }
+    }
+}
+
+/**
+ * @satisfies RUNNER-F-090 through RUNNER-F-095
+ */
+cb_result_code_t cb_runner_execute_interleaved(const cb_config_t *config,
+                                               const cb_ab_variant_t *variant_a,
+                                               const cb_ab_variant_t *variant_b,
+                                               uint32_t input_size,
+                                               uint32_t output_size,
+                                               uint32_t block_size,
+                                               cb_result_t *result_a,
+                                               cb_result_t *result_b)
+{
+    cb_runner_t runner_a, runner_b;
+    cb_timer_fast_t fast;
+    cb_result_code_t rc;
+    uint32_t block, pos, n, k;
+    uint32_t i;
+
+    if (config == NULL || variant_a == NULL || variant_b == NULL ||
+        variant_a->fn == NULL || variant_b->fn == NULL ||
+        result_a == NULL || result_b == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    rc = cb_config_validate(config);
+    if (rc != CB_OK) {
+        return rc;
+    }
+
+    if (variant_a->samples == NULL || variant_b->samples == NULL ||
+        variant_a->sample_capacity < config->measure_iterations ||
+        variant_b->sample_capacity < config->measure_iterations) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    block = (block_size > 1U) ? block_size : 1U;
+    k = (config->timing_batch > 1U) ? config->timing_batch : 1U;
+
+    rc = cb_runner_init(&runner_a, config,
+                        variant_a->samples, variant_a->sample_capacity);
+    if (rc != CB_OK) {
+        return rc;
+    }
+    rc = cb_runner_init(&runner_b, config,
+                        variant_b->samples, variant_b->sample_capacity);
+    if (rc != CB_OK) {
+        cb_runner_cleanup(&runner_a);
+        return rc;
+    }
+
+    /* Warmup both variants before any measurement so the first blocks
+     * of A and B start from comparable cache and branch state */
+    rc = cb_runner_warmup(&runner_a, variant_a->fn, variant_a->ctx,
+                          variant_a->input, input_size,
+                          variant_a->output, output_size);
+    if (rc == CB_OK) {
+        rc = cb_runner_warmup(&runner_b, variant_b->fn, variant_b->ctx,
+                              variant_b->input, input_size,
+                              variant_b->output, output_size);
+    }
+    if (rc != CB_OK) {
+        cb_runner_cleanup(&runner_a);
+        cb_runner_cleanup(&runner_b);
+        return rc;
+    }
+
+    if (cb_timer_fast_init(&fast) != CB_OK) {
+        cb_runner_cleanup(&runner_a);
+        cb_runner_cleanup(&runner_b);
+        return CB_ERR_TIMER_INIT;
+    }
+
+    /* RUNNER-F-091: alternate blocks of A and B within one session so
+     * both variants traverse the same thermal trajectory */
+    for (pos = 0; pos < config->measure_iterations; pos += n) {
+        n = config->measure_iterations - pos;
+        if (n > block) {
+            n = block;
+        }
+
+        execute_block(&runner_a, variant_a->fn, variant_a->ctx,
+                      variant_a->input, variant_a->output, output_size,
+                      &fast, pos, n);
+        execute_block(&runner_b, variant_b->fn, variant_b->ctx,
+                      variant_b->input, variant_b->output, output_size,
+                      &fast, pos, n);
+    }
+
+    /* Deferred conversion: raw deltas → per-call nanoseconds */
+    for (i = 0; i < config->measure_iterations; i++) {
+        runner_a.samples[i] = cb_cycles_to_ns(runner_a.samples[i]) / k;
+        runner_b.samples[i] = cb_cycles_to_ns(runner_b.samples[i]) / k;
+    }
+
+    runner_a.samples_collected = config->measure_iterations;
+    runner_b.samples_collected = config->measure_iterations;
+
+    rc = cb_runner_get_result(&runner_a, result_a);
+    if (rc == CB_OK) {
+        rc = cb_runner_get_result(&runner_b, result_b);
+    }
+
+    cb_runner_cleanup(&runner_a);
+    cb_runner_cleanup(&runner_b);
+
+    return rc;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Parallel Execution (SRS-003-RUNNER §4.7)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Arguments passed to each parallel worker thread
+ */
+typedef struct {
+    const cb_config_t *config;
+    cb_inference_fn fn;
+    cb_parallel_worker_t *worker;
+    uint32_t input_size;
+    uint32_t output_size;
+    cb_result_t *result;
+    cb_result_code_t rc;
+} parallel_thread_args_t;
+
+/**
+ * @brief Pin the calling thread to a specific core (best effort)
+ */
+static void pin_to_core(uint32_t core_id)
+{
+#ifdef __linux__
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET((size_t)core_id, &cpuset);
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+#else
+    (void)core_id;  /* Affinity not supported on this platform */
+#endif
+}
+
+/**
+ * @brief Worker thread body: pin, warmup, measure, compute result
+ */
+static void *parallel_worker_main(void *arg)
+{
+    parallel_thread_args_t *args = (parallel_thread_args_t *)arg;
+    cb_runner_t runner;
+    cb_result_code_t rc;
+
+    pin_to_core(args->worker->core_id);
+
+    rc = cb_runner_init(&runner, args->config,
+                        args->worker->samples, args->worker->sample_capacity);
+    if (rc != CB_OK) {
+        args->rc = rc;
+        return NULL;
+    }
+
+    rc = cb_runner_warmup(&runner, args->fn, args->worker->ctx,
+                          args->worker->input, args->input_size,
+                          args->worker->output, args->output_size);
+    if (rc != CB_OK) {
+        cb_runner_cleanup(&runner);
+        args->rc = rc;
+        return NULL;
+    }
+
+    rc = cb_runner_execute(&runner, args->fn, args->worker->ctx,
+                           args->worker->input, args->input_size,
+                           args->worker->output, args->output_size);
+    if (rc != CB_OK) {
+        cb_runner_cleanup(&runner);
+        args->rc = rc;
+        return NULL;
+    }
+
+    args->rc = cb_runner_get_result(&runner, args->result);
+    cb_runner_cleanup(&runner);
+    return NULL;
+}
+
+/** Maximum workers for cb_runner_execute_parallel() */
+#define CB_MAX_PARALLEL_WORKERS 256
+
+/**
+ * @brief Merge per-core latency statistics into an aggregate
+ *
+ * Delegates to cb_stats_merge() (CB-MATH-001 §6.8): exact pooled
+ * mean/variance, conservative maximum percentiles.
+ */
+static void merge_latency_stats(const cb_result_t *results,
+                                uint32_t num,
+                                cb_latency_stats_t *out,
+                                cb_fault_flags_t *faults)
+{
+    /* Static staging buffer — no dynamic allocation */
+    static cb_latency_stats_t parts[CB_MAX_PARALLEL_WORKERS];
+    uint32_t i;
+
+    for (i = 0; i < num; i++) {
+        parts[i] = results[i].latency;
+    }
+
+    (void)cb_stats_merge(parts, num, out, faults);
+}
+
+cb_result_code_t cb_runner_execute_parallel(const cb_config_t *config,
+                                            cb_inference_fn fn,
+                                            cb_parallel_worker_t *workers,
+                                            uint32_t num_workers,
+                                            uint32_t input_size,
+                                            uint32_t output_size,
+                                            cb_result_t *results,
+                                            cb_result_t *aggregate)
+{
+    /* Static thread-arg storage — no dynamic allocation */
+    static pthread_t threads[CB_MAX_PARALLEL_WORKERS];
+    static parallel_thread_args_t args[CB_MAX_PARALLEL_WORKERS];
+    uint32_t i;
+    cb_result_code_t rc = CB_OK;
+
+    if (config == NULL || fn == NULL || workers == NULL || results == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (num_workers == 0 || num_workers > CB_MAX_PARALLEL_WORKERS) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    rc = cb_config_validate(config);
+    if (rc != CB_OK) {
+        return rc;
+    }
+
+    for (i = 0; i < num_workers; i++) {
+        if (workers[i].samples == NULL ||
+            workers[i].sample_capacity < config->measure_iterations) {
+            return CB_ERR_INVALID_CONFIG;
+        }
+    }
+
+    /* Timer is process-global — initialise once before spawning workers */
+    if (cb_timer_init(config->timer_source) == CB_TIMER_AUTO) {
+        return CB_ERR_TIMER_INIT;
+    }
+
+    for (i = 0; i < num_workers; i++) {
+        args[i].config = config;
+        args[i].fn = fn;
+        args[i].worker = &workers[i];
+        args[i].input_size = input_size;
+        args[i].output_size = output_size;
+        args[i].result = &results[i];
+        args[i].rc = CB_OK;
+
+        if (pthread_create(&threads[i], NULL, parallel_worker_main, &args[i]) != 0) {
+            /* Join already-started workers before reporting failure */
+            uint32_t j;
+            for (j = 0; j < i; j++) {
+                pthread_join(threads[j], NULL);
+            }
+            return CB_ERR_INVALID_CONFIG;
+        }
+    }
+
+    for (i = 0; i < num_workers; i++) {
+        pthread_join(threads[i], NULL);
+        if (args[i].rc != CB_OK && rc == CB_OK) {
+            rc = args[i].rc;
+        }
+    }
+
+    if (rc != CB_OK) {
+        return rc;
+    }
+
+    if (aggregate != NULL) {
+        cb_fault_flags_t merge_faults;
+
+        memset(aggregate, 0, sizeof(*aggregate));
+        cb_fault_clear(&merge_faults);
+
+        /* Platform identification and config echo from first worker */
+        memcpy(aggregate->platform, results[0].platform, CB_MAX_PLATFORM);
+        memcpy(aggregate->cpu_model, results[0].cpu_model, CB_MAX_CPU_MODEL);
+        aggregate->cpu_freq_mhz = results[0].cpu_freq_mhz;
+        aggregate->warmup_iterations = config->warmup_iterations;
+        aggregate->measure_iterations = config->measure_iterations;
+        aggregate->batch_size = config->batch_size;
+
+        merge_latency_stats(results, num_workers, &aggregate->latency, &merge_faults);
+
+        /* Aggregate throughput is the fleet sum — all cores ran concurrently */
+        for (i = 0; i < num_workers; i++) {
+            aggregate->throughput.inferences_per_sec +=
+                results[i].throughput.inferences_per_sec;
+            aggregate->throughput.samples_per_sec +=
+                results[i].throughput.samples_per_sec;
+            aggregate->verification_failures += results[i].verification_failures;
+        }
+        aggregate->throughput.batch_size = config->batch_size;
+
+        /* Environment from first worker (shared package sensors) */
+        aggregate->environment = results[0].environment;
+        aggregate->env_stable = results[0].env_stable;
+
+        /* Determinism holds only if every core verified */
+        aggregate->determinism_verified = true;
+        for (i = 0; i < num_workers; i++) {
+            if (!results[i].determinism_verified) {
+                aggregate->determinism_verified = false;
+            }
+            /* OR all fault flags into the aggregate */
+            if (results[i].faults.overflow)      aggregate->faults.overflow = 1;
+            if (results[i].faults.underflow)     aggregate->faults.underflow = 1;
+            if (results[i].faults.div_zero)      aggregate->faults.div_zero = 1;
+            if (results[i].faults.timer_error)   aggregate->faults.timer_error = 1;
+            if (results[i].faults.verify_fail)   aggregate->faults.verify_fail = 1;
+            if (results[i].faults.thermal_drift) aggregate->faults.thermal_drift = 1;
+        }
+        if (merge_faults.overflow) aggregate->faults.overflow = 1;
+        if (merge_faults.div_zero) aggregate->faults.div_zero = 1;
+
+        aggregate->timestamp_unix = results[0].timestamp_unix;
+    }
+
+    return CB_OK;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Convenience API
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -0,0 +1,316 @@
+/**
+ * @file suite.c
+ * @brief Multi-configuration suite driver implementation
+ *
+ * Implements SRS-009-SUITE: sequential execution of a suite of
+ * benchmark configurations in one process. Fixed setup (platform
+ * identification, timer calibration) is paid once; per-run JSON
+ * serialisation runs on a double-buffered writer thread and overlaps
+ * the next entry's warmup, so report I/O never extends the critical
+ * path between measurements. An aggregate report summarises the
+ * whole pass.
+ *
+ * @traceability SRS-009-SUITE
+ *
+ * Copyright © 2026 The Murray Family Innovation Trust. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "cb_suite.h"
+#include "cb_runner.h"
+#include "cb_report.h"
+#include "cb_timer.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Overlapped Report Writing (SRS-009-SUITE §4.3)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Shared state between the suite loop and the writer thread
+ *
+ * Two job slots alternate between the producer (suite loop) and the
+ * consumer (writer thread), mirroring the pipelined-verification
+ * pattern in the runner. A full slot holds a completed result
+ * awaiting serialisation; the producer only blocks when both slots
+ * are full — i.e. when two runs finished faster than one JSON write,
+ * which a warmup phase in between makes rare.
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t can_submit;
+    pthread_cond_t can_write;
+    const cb_result_t *jobs[2];
+    const char *paths[2];
+    int job_full[2];
+    uint32_t head;              /* Next slot the writer drains */
+    uint32_t tail;              /* Next slot a submission fills */
+    bool done;
+    cb_result_code_t rc;        /* First write failure, if any */
+} suite_writer_t;
+
+/**
+ * @brief Writer thread: serialise completed results in order
+ */
+static void *suite_writer_main(void *arg)
+{
+    suite_writer_t *writer = (suite_writer_t *)arg;
+
+    for (;;) {
+        const cb_result_t *job;
+        const char *path;
+        cb_result_code_t rc;
+
+        pthread_mutex_lock(&writer->lock);
+        while (!writer->job_full[writer->head] && !writer->done) {
+            pthread_cond_wait(&writer->can_write, &writer->lock);
+        }
+        if (!writer->job_full[writer->head] && writer->done) {
+            pthread_mutex_unlock(&writer->lock);
+            break;
+        }
+        job = writer->jobs[writer->head];
+        path = writer->paths[writer->head];
+        pthread_mutex_unlock(&writer->lock);
+
+        /* Serialise outside the lock — the suite loop is warming up
+         * the next entry meanwhile */
+        rc = cb_write_json(job, path);
+
+        pthread_mutex_lock(&writer->lock);
+        if (rc != CB_OK && writer->rc == CB_OK) {
+            writer->rc = rc;
+        }
+        writer->job_full[writer->head] = 0;
+        writer->head ^= 1U;
+        pthread_cond_signal(&writer->can_submit);
+        pthread_mutex_unlock(&writer->lock);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Hand a completed result to the writer thread
+ */
+static void suite_writer_submit(suite_writer_t *writer,
+                                const cb_result_t *result,
+                                const char *path)
+{
+    pthread_mutex_lock(&writer->lock);
+    while (writer->job_full[writer->tail]) {
+        pthread_cond_wait(&writer->can_submit, &writer->lock);
+    }
+    writer->jobs[writer->tail] = result;
+    writer->paths[writer->tail] = path;
+    writer->job_full[writer->tail] = 1;
+    writer->tail ^= 1U;
+    pthread_cond_signal(&writer->can_write);
+    pthread_mutex_unlock(&writer->lock);
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Aggregate Suite Report (SRS-009-SUITE §4.4)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Write the aggregate suite report
+ *
+ * One JSON document with suite totals and a per-run summary line for
+ * each entry — the figures a nightly dashboard reads, with the full
+ * evidence in the per-run reports.
+ *
+ * @satisfies SUITE-F-005
+ */
+static cb_result_code_t write_suite_report(const char *path,
+                                           const cb_suite_entry_t *entries,
+                                           const cb_result_t *results,
+                                           uint32_t num_entries,
+                                           uint32_t failures,
+                                           uint64_t wall_ns)
+{
+    FILE *fp;
+    uint32_t i;
+
+    fp = fopen(path, "w");
+    if (fp == NULL) {
+        return CB_ERR_IO;
+    }
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"suite_version\": \"1.0\",\n");
+    fprintf(fp, "  \"platform\": \"%s\",\n", results[0].platform);
+    fprintf(fp, "  \"entries\": %" PRIu32 ",\n", num_entries);
+    fprintf(fp, "  \"failures\": %" PRIu32 ",\n", failures);
+    fprintf(fp, "  \"total_wall_ns\": %" PRIu64 ",\n", wall_ns);
+    fprintf(fp, "  \"runs\": [\n");
+
+    for (i = 0; i < num_entries; i++) {
+        const cb_result_t *r = &results[i];
+
+        fprintf(fp, "    { \"name\": \"");
+        if (entries[i].name != NULL) {
+            fprintf(fp, "%s", entries[i].name);
+        } else {
+            fprintf(fp, "entry-%" PRIu32, i);
+        }
+        fprintf(fp, "\",\n");
+        fprintf(fp, "      \"mean_ns\": %" PRIu64
+                    ", \"p99_ns\": %" PRIu64
+                    ", \"wcet_bound_ns\": %" PRIu64 ",\n",
+                r->latency.mean_ns, r->latency.p99_ns,
+                r->latency.wcet_bound_ns);
+        fprintf(fp, "      \"inferences_per_sec\": %" PRIu64
+                    ", \"verified\": %s, \"valid\": %s }%s\n",
+                r->throughput.inferences_per_sec,
+                r->determinism_verified ? "true" : "false",
+                cb_result_is_valid(r) ? "true" : "false",
+                (i + 1 < num_entries) ? "," : "");
+    }
+
+    fprintf(fp, "  ]\n");
+    fprintf(fp, "}\n");
+
+    if (fclose(fp) != 0) {
+        return CB_ERR_IO;
+    }
+    return CB_OK;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Suite Execution (SRS-009-SUITE §4.2)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Run a suite of benchmark configurations in one process
+ * @satisfies SUITE-F-001 through SUITE-F-006
+ */
+cb_result_code_t cb_suite_run(const cb_suite_entry_t *entries,
+                              uint32_t num_entries,
+                              cb_result_t *results,
+                              const char *report_path)
+{
+    suite_writer_t writer;
+    pthread_t writer_thread;
+    uint32_t i;
+    uint32_t failures = 0;
+    uint64_t wall_start, wall_end;
+    cb_result_code_t rc;
+    cb_result_code_t suite_rc = CB_OK;
+
+    if (entries == NULL || results == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (num_entries == 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* SUITE-F-002: validate every entry before running any — a typo
+     * in configuration 700 must not surface six hours in */
+    for (i = 0; i < num_entries; i++) {
+        if (entries[i].fn == NULL || entries[i].samples == NULL) {
+            return CB_ERR_NULL_PTR;
+        }
+        rc = cb_config_validate(&entries[i].config);
+        if (rc != CB_OK) {
+            return rc;
+        }
+    }
+
+    /* SUITE-F-001: timer calibration happens here, once. The per-run
+     * cb_runner_init() calls re-enter cb_timer_init() with the same
+     * source and short-circuit. */
+    if (cb_timer_init(entries[0].config.timer_source) == CB_TIMER_AUTO) {
+        return CB_ERR_TIMER_INIT;
+    }
+
+    memset(&writer, 0, sizeof(writer));
+    pthread_mutex_init(&writer.lock, NULL);
+    pthread_cond_init(&writer.can_submit, NULL);
+    pthread_cond_init(&writer.can_write, NULL);
+    writer.rc = CB_OK;
+
+    if (pthread_create(&writer_thread, NULL, suite_writer_main, &writer) != 0) {
+        pthread_cond_destroy(&writer.can_write);
+        pthread_cond_destroy(&writer.can_submit);
+        pthread_mutex_destroy(&writer.lock);
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    wall_start = cb_timer_now_ns();
+
+    for (i = 0; i < num_entries; i++) {
+        const cb_suite_entry_t *entry = &entries[i];
+        cb_runner_t runner;
+
+        rc = cb_runner_init(&runner, &entry->config,
+                            entry->samples, entry->sample_capacity);
+        if (rc != CB_OK) {
+            suite_rc = rc;
+            break;
+        }
+
+        /* SUITE-F-004: while this entry warms up, the writer thread
+         * is still serialising the previous entry's report */
+        rc = cb_runner_warmup(&runner, entry->fn, entry->ctx,
+                              entry->input, entry->input_size,
+                              entry->output, entry->output_size);
+        if (rc == CB_OK) {
+            rc = cb_runner_execute(&runner, entry->fn, entry->ctx,
+                                   entry->input, entry->input_size,
+                                   entry->output, entry->output_size);
+        }
+        if (rc != CB_OK) {
+            cb_runner_cleanup(&runner);
+            suite_rc = rc;
+            break;
+        }
+
+        cb_runner_get_result(&runner, &results[i]);
+        cb_runner_cleanup(&runner);
+
+        /* SUITE-F-003: invalid runs are counted, not fatal — the rest
+         * of the nightly pass still produces evidence */
+        if (!cb_result_is_valid(&results[i])) {
+            failures++;
+        }
+
+        if (entry->config.output_path != NULL) {
+            suite_writer_submit(&writer, &results[i],
+                                entry->config.output_path);
+        }
+    }
+
+    wall_end = cb_timer_now_ns();
+
+    /* Drain the writer before reporting */
+    pthread_mutex_lock(&writer.lock);
+    writer.done = true;
+    pthread_cond_signal(&writer.can_write);
+    pthread_mutex_unlock(&writer.lock);
+    pthread_join(writer_thread, NULL);
+
+    pthread_cond_destroy(&writer.can_write);
+    pthread_cond_destroy(&writer.can_submit);
+    pthread_mutex_destroy(&writer.lock);
+
+    if (suite_rc != CB_OK) {
+        return suite_rc;
+    }
+    if (writer.rc != CB_OK) {
+        return writer.rc;
+    }
+
+    /* SUITE-F-005: aggregate suite report */
+    if (report_path != NULL) {
+        return write_suite_report(report_path, entries, results,
+                                  num_entries, failures,
+                                  wall_end - wall_start);
+    }
+
+    return CB_OK;
+}
@@ -2,9 +2,11 @@
  * @file timer.c
  * @brief Timer subsystem implementation
  *
- * Implements SRS-001-TIMER requirements with POSIX backend.
- * Additional backends (RDTSC, CNTVCT, RISC-V) can be added via
- * compile-time platform detection.
+ * Implements SRS-001-TIMER requirements. Backends: POSIX clock_gettime
+ * (always available), x86 invariant RDTSC, ARM64 CNTVCT_EL0, and the
+ * RISC-V cycle CSR, selected via compile-time platform detection plus
+ * runtime capability checks. Cycle counters are calibrated to
+ * nanoseconds through cb_timer_state_t.freq_hz.
  *
  * @traceability SRS-001-TIMER
  *
@@ -27,6 +29,9 @@
 /** Number of calibration iterations for overhead measurement */
 #define CALIBRATION_ITERATIONS 1000
 
+/** Window for measuring cycle-counter frequency against POSIX time */
+#define FREQ_CALIBRATION_WINDOW_NS (10 * CB_NS_PER_MS)
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Global State (CB-STRUCT-001 §8)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -40,6 +45,9 @@ static cb_fault_flags_t g_timer_faults;
 /** Initialisation flag */
 static bool g_timer_initialized = false;
 
+/** Source requested at the last initialisation (for re-init short-circuit) */
+static cb_timer_source_t g_timer_requested = CB_TIMER_AUTO;
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Backend Names
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -96,6 +104,108 @@ static uint64_t posix_resolution_ns(void)
     return (res > 0) ? res : 1;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * x86 RDTSC Backend (SRS-001-TIMER §5.2)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <cpuid.h>
+#include <x86intrin.h>
+
+/**
+ * @brief Read the time-stamp counter with load serialisation
+ *
+ * LFENCE before RDTSC guarantees all prior loads have completed, so the
+ * reading cannot drift backwards past the work being timed. RDTSC itself
+ * costs ~6 ns versus ~25 ns for clock_gettime().
+ *
+ * @return Raw TSC cycle count
+ *
+ * @satisfies TIMER-P-010, TIMER-P-011
+ * @traceability SRS-001-TIMER §5.2
+ */
+static uint64_t rdtsc_read_cycles(void)
+{
+    _mm_lfence();
+    return __rdtsc();
+}
+
+#endif /* x86 */
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * ARM64 CNTVCT Backend (SRS-001-TIMER §5.3)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#if defined(__aarch64__)
+
+/**
+ * @brief Read the virtual counter with instruction serialisation
+ *
+ * ISB prevents speculative early reads of CNTVCT_EL0. The counter runs
+ * at the fixed architectural frequency reported by CNTFRQ_EL0 and is
+ * invariant across cores and frequency scaling.
+ *
+ * @return Raw CNTVCT_EL0 cycle count
+ *
+ * @traceability SRS-001-TIMER §5.3
+ */
+static uint64_t cntvct_read_cycles(void)
+{
+    uint64_t value;
+    __asm__ volatile("isb\n\tmrs %0, cntvct_el0" : "=r"(value));
+    return value;
+}
+
+/**
+ * @brief Read the architectural counter frequency
+ *
+ * @return CNTFRQ_EL0 in Hz (0 if firmware left it unprogrammed)
+ */
+static uint64_t cntvct_freq_hz(void)
+{
+    uint64_t freq;
+    __asm__ volatile("mrs %0, cntfrq_el0" : "=r"(freq));
+    return freq;
+}
+
+#endif /* __aarch64__ */
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * RISC-V Cycle-CSR Backend (SRS-001-TIMER §5.4)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#if defined(__riscv)
+
+/**
+ * @brief Read the cycle CSR
+ *
+ * On RV32 the 64-bit counter spans two CSRs; the high half is re-read
+ * until stable to handle carry between the two reads.
+ *
+ * @return Raw cycle count
+ *
+ * @traceability SRS-001-TIMER §5.4
+ */
+static uint64_t riscv_read_cycles(void)
+{
+#if __riscv_xlen == 64
+    uint64_t value;
+    __asm__ volatile("rdcycle %0" : "=r"(value));
+    return value;
+#else
+    uint32_t hi0, lo, hi1;
+    do {
+        __asm__ volatile("rdcycleh %0" : "=r"(hi0));
+        __asm__ volatile("rdcycle %0" : "=r"(lo));
+        __asm__ volatile("rdcycleh %0" : "=r"(hi1));
+    } while (hi0 != hi1);
+    return ((uint64_t)hi1 << 32) | lo;
+#endif
+}
+
+#endif /* __riscv */
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Platform Detection
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -103,6 +213,11 @@ static uint64_t posix_resolution_ns(void)
 /**
  * @brief Check if RDTSC is available and invariant
  *
+ * Only the invariant TSC (CPUID.80000007H:EDX[8]) is acceptable: it
+ * ticks at a constant rate regardless of frequency scaling and deep
+ * sleep states, so calibrated cycle-to-ns conversion stays valid for
+ * the whole benchmark.
+ *
  * @return true if x86 invariant TSC is available
  *
  * @satisfies TIMER-P-012
@@ -110,10 +225,13 @@ static uint64_t posix_resolution_ns(void)
  */
 static bool rdtsc_available(void)
 {
-#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
-    /* TODO: Implement CPUID check for invariant TSC */
-    /* For now, fall back to POSIX */
-    return false;
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid(0x80000007U, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+    }
+    return (edx & (1U << 8)) != 0;
 #else
     return false;
 #endif
@@ -122,15 +240,18 @@ static bool rdtsc_available(void)
 /**
  * @brief Check if ARM64 CNTVCT is available
  *
+ * Linux enables EL0 access to the virtual counter; a zero CNTFRQ_EL0
+ * means firmware never programmed the frequency and calibration would
+ * be meaningless.
+ *
  * @return true if ARM64 virtual counter is available
  *
  * @traceability SRS-001-TIMER §5.3
  */
 static bool cntvct_available(void)
 {
-#if defined(__aarch64__) || defined(_M_ARM64)
-    /* TODO: Implement ARM64 backend */
-    return false;
+#if defined(__aarch64__)
+    return cntvct_freq_hz() != 0;
 #else
     return false;
 #endif
@@ -139,6 +260,9 @@ static bool cntvct_available(void)
 /**
  * @brief Check if RISC-V cycle CSR is available
  *
+ * @note Some kernels restrict user-mode cycle-CSR access; on such
+ *       systems select CB_TIMER_POSIX explicitly.
+ *
  * @return true if RISC-V cycle counter is available
  *
  * @traceability SRS-001-TIMER §5.4
@@ -146,13 +270,92 @@ static bool cntvct_available(void)
 static bool riscv_available(void)
 {
 #if defined(__riscv)
-    /* TODO: Implement RISC-V backend */
-    return false;
+    return true;
 #else
     return false;
 #endif
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Backend Dispatch
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Convert cycles to nanoseconds without the initialisation check
+ *
+ * Shared by cb_cycles_to_ns() and the backend read path (which runs
+ * during calibration, before the initialised flag is set).
+ *
+ * @param cycles Cycle count from the active backend
+ * @return Nanoseconds (saturates to UINT64_MAX on overflow)
+ */
+static uint64_t cycles_to_ns_raw(uint64_t cycles)
+{
+    /* For POSIX backend, cycles == nanoseconds */
+    if (g_timer_state.freq_hz == 0) {
+        return cycles;
+    }
+
+    /* ns = cycles * 1e9 / freq_hz, split to avoid 64-bit overflow:
+     * (cycles / freq_hz) * 1e9 + (cycles % freq_hz) * 1e9 / freq_hz */
+    uint64_t whole_secs = cycles / g_timer_state.freq_hz;
+    uint64_t remainder = cycles % g_timer_state.freq_hz;
+
+    if (whole_secs > UINT64_MAX / CB_NS_PER_SEC) {
+        g_timer_faults.overflow = 1;
+        return UINT64_MAX;
+    }
+
+    uint64_t ns_from_whole = whole_secs * CB_NS_PER_SEC;
+    uint64_t ns_from_remainder = (remainder * CB_NS_PER_SEC) / g_timer_state.freq_hz;
+
+    if (ns_from_whole > UINT64_MAX - ns_from_remainder) {
+        g_timer_faults.overflow = 1;
+        return UINT64_MAX;
+    }
+
+    return ns_from_whole + ns_from_remainder;
+}
+
+/**
+ * @brief Read the active backend and convert to nanoseconds
+ *
+ * Does not check the initialised flag — cb_timer_init() uses this
+ * while calibrating the freshly selected backend.
+ *
+ * @return Timestamp in nanoseconds
+ */
+static uint64_t backend_now_ns(void)
+{
+    switch (g_timer_state.source) {
+    case CB_TIMER_RDTSC:
+#if defined(__x86_64__) || defined(__i386__)
+        return cycles_to_ns_raw(rdtsc_read_cycles());
+#else
+        return posix_now_ns();
+#endif
+
+    case CB_TIMER_CNTVCT:
+#if defined(__aarch64__)
+        return cycles_to_ns_raw(cntvct_read_cycles());
+#else
+        return posix_now_ns();
+#endif
+
+    case CB_TIMER_RISCV_CYCLE:
+#if defined(__riscv)
+        return cycles_to_ns_raw(riscv_read_cycles());
+#else
+        return posix_now_ns();
+#endif
+
+    case CB_TIMER_POSIX:
+    case CB_TIMER_AUTO:
+    default:
+        return posix_now_ns();
+    }
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Calibration
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -175,8 +378,8 @@ static uint64_t calibrate_overhead(void)
     int i;
 
     for (i = 0; i < CALIBRATION_ITERATIONS; i++) {
-        start = posix_now_ns();
-        end = posix_now_ns();
+        start = backend_now_ns();
+        end = backend_now_ns();
 
         if (start == 0 || end == 0) {
             continue;  /* Timer error, skip this sample */
@@ -192,6 +395,47 @@ static uint64_t calibrate_overhead(void)
     return (min_overhead == UINT64_MAX) ? 0 : min_overhead;
 }
 
+#if defined(__x86_64__) || defined(__i386__) || defined(__riscv)
+
+/**
+ * @brief Measure cycle-counter frequency against CLOCK_MONOTONIC
+ *
+ * Brackets a fixed POSIX-clock window with raw cycle reads. A 10 ms
+ * window bounds the calibration error well below the thermal-drift
+ * tolerance, while keeping cb_timer_init() fast. Used for counters
+ * with no architectural frequency register (TSC, RISC-V cycle CSR).
+ *
+ * @param read_cycles Raw cycle read function for the backend
+ * @return Measured frequency in Hz, or 0 on failure
+ *
+ * @satisfies TIMER-F-030
+ * @traceability SRS-001-TIMER §6.2
+ */
+static uint64_t measure_freq_hz(uint64_t (*read_cycles)(void))
+{
+    uint64_t c0, c1, ns0, ns1;
+
+    c0 = read_cycles();
+    ns0 = posix_now_ns();
+    if (ns0 == 0) {
+        return 0;
+    }
+    do {
+        ns1 = posix_now_ns();
+    } while (ns1 != 0 && ns1 - ns0 < FREQ_CALIBRATION_WINDOW_NS);
+    c1 = read_cycles();
+
+    if (ns1 <= ns0 || c1 <= c0) {
+        return 0;
+    }
+
+    /* freq = dcycles * 1e9 / dns; dcycles over 10 ms stays far below
+     * the 64-bit overflow bound (~1.8e10 cycles) */
+    return ((c1 - c0) * CB_NS_PER_SEC) / (ns1 - ns0);
+}
+
+#endif /* frequency-measured backends */
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Public API Implementation (SRS-001-TIMER §7)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -201,6 +445,16 @@ static uint64_t calibrate_overhead(void)
  */
 cb_timer_source_t cb_timer_init(cb_timer_source_t source)
 {
+    /* Re-initialising with the same requested source is a no-op:
+     * backend selection is deterministic on fixed hardware, so the
+     * calibration from the first initialisation stands. Suite runs
+     * (SRS-009-SUITE) re-enter here once per configuration — paying
+     * CALIBRATION_ITERATIONS again each time would be pure setup
+     * overhead. A different requested source still re-initialises. */
+    if (g_timer_initialized && source == g_timer_requested) {
+        return g_timer_state.source;
+    }
+
     /* Clear state */
     memset(&g_timer_state, 0, sizeof(g_timer_state));
     cb_fault_clear(&g_timer_faults);
@@ -236,23 +490,51 @@ cb_timer_source_t cb_timer_init(cb_timer_source_t source)
         selected = CB_TIMER_POSIX;
     }
 
+    /* Calibrate frequency for the cycle-counter backends. freq_hz == 0
+     * means reads are already in nanoseconds (POSIX). */
+    g_timer_state.freq_hz = 0;
+#if defined(__x86_64__) || defined(__i386__)
+    if (selected == CB_TIMER_RDTSC) {
+        g_timer_state.freq_hz = measure_freq_hz(rdtsc_read_cycles);
+        if (g_timer_state.freq_hz == 0) {
+            selected = CB_TIMER_POSIX;  /* Calibration failed */
+        }
+    }
+#elif defined(__aarch64__)
+    if (selected == CB_TIMER_CNTVCT) {
+        /* Architectural frequency — no measurement needed */
+        g_timer_state.freq_hz = cntvct_freq_hz();
+    }
+#elif defined(__riscv)
+    if (selected == CB_TIMER_RISCV_CYCLE) {
+        g_timer_state.freq_hz = measure_freq_hz(riscv_read_cycles);
+        if (g_timer_state.freq_hz == 0) {
+            selected = CB_TIMER_POSIX;  /* Calibration failed */
+        }
+    }
+#endif
+
+    g_timer_state.source = selected;
+
     /* Verify selected timer works */
-    uint64_t test_time = posix_now_ns();
+    uint64_t test_time = backend_now_ns();
     if (test_time == 0) {
         g_timer_faults.timer_error = 1;
         /* Continue anyway — state will reflect error */
     }
 
-    /* Get resolution */
-    g_timer_state.resolution_ns = posix_resolution_ns();
+    /* Resolution: one cycle for cycle counters, clock_getres for POSIX */
+    if (g_timer_state.freq_hz != 0) {
+        uint64_t res = CB_NS_PER_SEC / g_timer_state.freq_hz;
+        g_timer_state.resolution_ns = (res > 0) ? res : 1;
+    } else {
+        g_timer_state.resolution_ns = posix_resolution_ns();
+    }
 
-    /* Calibrate overhead */
+    /* Calibrate overhead of the selected backend */
     g_timer_state.calibration_ns = calibrate_overhead();
 
-    /* For POSIX, frequency is not applicable */
-    g_timer_state.freq_hz = 0;
-
-    g_timer_state.source = selected;
+    g_timer_requested = source;
     g_timer_initialized = true;
 
     return selected;
@@ -268,27 +550,24 @@ uint64_t cb_timer_now_ns(void)
         return 0;
     }
 
-    /* Currently only POSIX is implemented */
-    switch (g_timer_state.source) {
-    case CB_TIMER_POSIX:
-        return posix_now_ns();
-
-    case CB_TIMER_RDTSC:
-        /* TODO: Implement RDTSC backend */
-        return posix_now_ns();
-
-    case CB_TIMER_CNTVCT:
-        /* TODO: Implement CNTVCT backend */
-        return posix_now_ns();
-
-    case CB_TIMER_RISCV_CYCLE:
-        /* TODO: Implement RISC-V backend */
-        return posix_now_ns();
+    return backend_now_ns();
+}
 
-    default:
-        g_timer_faults.timer_error = 1;
-        return 0;
+/**
+ * @satisfies TIMER-F-010, TIMER-NF-003
+ */
+cb_result_code_t cb_timer_fast_init(cb_timer_fast_t *fast)
+{
+    if (fast == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (!g_timer_initialized) {
+        return CB_ERR_TIMER_INIT;
     }
+
+    fast->source = g_timer_state.source;
+    fast->_padding = 0;
+    return CB_OK;
 }
 
 /**
@@ -311,35 +590,7 @@ uint64_t cb_cycles_to_ns(uint64_t cycles)
         return 0;
     }
 
-    /* For POSIX backend, cycles == nanoseconds */
-    if (g_timer_state.freq_hz == 0) {
-        return cycles;
-    }
-
-    /* For cycle counter backends: ns = cycles * 1e9 / freq_hz */
-    /* Use 128-bit arithmetic to avoid overflow */
-    /* cycles * CB_NS_PER_SEC / freq_hz */
-
-    /* Split to avoid overflow: (cycles / freq_hz) * 1e9 + remainder */
-    uint64_t whole_secs = cycles / g_timer_state.freq_hz;
-    uint64_t remainder = cycles % g_timer_state.freq_hz;
-
-    /* Overflow check for whole_secs * CB_NS_PER_SEC */
-    if (whole_secs > UINT64_MAX / CB_NS_PER_SEC) {
-        g_timer_faults.overflow = 1;
-        return UINT64_MAX;
-    }
-
-    uint64_t ns_from_whole = whole_secs * CB_NS_PER_SEC;
-    uint64_t ns_from_remainder = (remainder * CB_NS_PER_SEC) / g_timer_state.freq_hz;
-
-    /* Check for final overflow */
-    if (ns_from_whole > UINT64_MAX - ns_from_remainder) {
-        g_timer_faults.overflow = 1;
-        return UINT64_MAX;
-    }
-
-    return ns_from_whole + ns_from_remainder;
+    return cycles_to_ns_raw(cycles);
 }
 
 /**
@@ -13,6 +13,7 @@
 
 #include "cb_verify.h"
 
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -105,6 +106,468 @@ static void sha256_transform(uint32_t state[8], const uint8_t block[64])
     state[4] += e; state[5] += f; state[6] += g; state[7] += h;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Hardware-Accelerated Compression (SRS-004-VERIFY §5.2)
+ *
+ * Runtime-dispatched SHA-NI (x86) and ARMv8 Crypto Extension paths.
+ * The scalar sha256_transform() above remains the certified fallback;
+ * accelerated paths produce bit-identical digests (FIPS 180-4) and are
+ * validated against the same test vectors.
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define CB_SHA_ACCEL_X86 1
+#include <immintrin.h>
+#include <cpuid.h>
+#elif defined(__aarch64__) && defined(__GNUC__) && defined(__linux__)
+#define CB_SHA_ACCEL_ARM 1
+#include <arm_neon.h>
+#include <sys/auxv.h>
+#ifndef HWCAP_SHA2
+#define HWCAP_SHA2 (1UL << 6)
+#endif
+#endif
+
+/** Accelerator state: -1 = undetected, 0 = scalar only, 1 = hardware */
+static int g_sha_accel = -1;
+
+#ifdef CB_SHA_ACCEL_X86
+
+/**
+ * @brief Multi-block SHA-256 compression using x86 SHA-NI
+ *
+ * Standard Intel SHA extensions schedule: state held as ABEF/CDGH
+ * vectors, two rounds per sha256rnds2 issue.
+ */
+__attribute__((target("sha,ssse3,sse4.1")))
+static void sha256_transform_hw(uint32_t state[8], const uint8_t *data,
+                                uint32_t nblocks)
+{
+    __m128i STATE0, STATE1, MSG, TMP;
+    __m128i MSG0, MSG1, MSG2, MSG3;
+    __m128i ABEF_SAVE, CDGH_SAVE;
+    const __m128i MASK = _mm_set_epi64x((long long)0x0c0d0e0f08090a0bULL,
+                                        (long long)0x0405060700010203ULL);
+
+    /* Load and interleave initial state */
+    TMP = _mm_loadu_si128((const __m128i *)(const void *)&state[0]);
+    STATE1 = _mm_loadu_si128((const __m128i *)(const void *)&state[4]);
+    TMP = _mm_shuffle_epi32(TMP, 0xB1);          /* CDAB */
+    STATE1 = _mm_shuffle_epi32(STATE1, 0x1B);    /* EFGH */
+    STATE0 = _mm_alignr_epi8(TMP, STATE1, 8);    /* ABEF */
+    STATE1 = _mm_blend_epi16(STATE1, TMP, 0xF0); /* CDGH */
+
+    while (nblocks > 0) {
+        ABEF_SAVE = STATE0;
+        CDGH_SAVE = STATE1;
+
+        /* Rounds 0-3 */
+        MSG = _mm_loadu_si128((const __m128i *)(const void *)(data + 0));
+        MSG0 = _mm_shuffle_epi8(MSG, MASK);
+        MSG = _mm_add_epi32(MSG0, _mm_set_epi64x((long long)0xE9B5DBA5B5C0FBCFULL,
+                                                 (long long)0x71374491428A2F98ULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+
+        /* Rounds 4-7 */
+        MSG1 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i *)(const void *)(data + 16)), MASK);
+        MSG = _mm_add_epi32(MSG1, _mm_set_epi64x((long long)0xAB1C5ED5923F82A4ULL,
+                                                 (long long)0x59F111F13956C25BULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        MSG0 = _mm_sha256msg1_epu32(MSG0, MSG1);
+
+        /* Rounds 8-11 */
+        MSG2 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i *)(const void *)(data + 32)), MASK);
+        MSG = _mm_add_epi32(MSG2, _mm_set_epi64x((long long)0x550C7DC3243185BEULL,
+                                                 (long long)0x12835B01D807AA98ULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        MSG1 = _mm_sha256msg1_epu32(MSG1, MSG2);
+
+        /* Rounds 12-15 */
+        MSG3 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i *)(const void *)(data + 48)), MASK);
+        MSG = _mm_add_epi32(MSG3, _mm_set_epi64x((long long)0xC19BF1749BDC06A7ULL,
+                                                 (long long)0x80DEB1FE72BE5D74ULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        TMP = _mm_alignr_epi8(MSG3, MSG2, 4);
+        MSG0 = _mm_add_epi32(MSG0, TMP);
+        MSG0 = _mm_sha256msg2_epu32(MSG0, MSG3);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        MSG2 = _mm_sha256msg1_epu32(MSG2, MSG3);
+
+        /* Rounds 16-19 */
+        MSG = _mm_add_epi32(MSG0, _mm_set_epi64x((long long)0x240CA1CC0FC19DC6ULL,
+                                                 (long long)0xEFBE4786E49B69C1ULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        TMP = _mm_alignr_epi8(MSG0, MSG3, 4);
+        MSG1 = _mm_add_epi32(MSG1, TMP);
+        MSG1 = _mm_sha256msg2_epu32(MSG1, MSG0);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        MSG3 = _mm_sha256msg1_epu32(MSG3, MSG0);
+
+        /* Rounds 20-23 */
+        MSG = _mm_add_epi32(MSG1, _mm_set_epi64x((long long)0x76F988DA5CB0A9DCULL,
+                                                 (long long)0x4A7484AA2DE92C6FULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        TMP = _mm_alignr_epi8(MSG1, MSG0, 4);
+        MSG2 = _mm_add_epi32(MSG2, TMP);
+        MSG2 = _mm_sha256msg2_epu32(MSG2, MSG1);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        MSG0 = _mm_sha256msg1_epu32(MSG0, MSG1);
+
+        /* Rounds 24-27 */
+        MSG = _mm_add_epi32(MSG2, _mm_set_epi64x((long long)0xBF597FC7B00327C8ULL,
+                                                 (long long)0xA831C66D983E5152ULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        TMP = _mm_alignr_epi8(MSG2, MSG1, 4);
+        MSG3 = _mm_add_epi32(MSG3, TMP);
+        MSG3 = _mm_sha256msg2_epu32(MSG3, MSG2);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        MSG1 = _mm_sha256msg1_epu32(MSG1, MSG2);
+
+        /* Rounds 28-31 */
+        MSG = _mm_add_epi32(MSG3, _mm_set_epi64x((long long)0x1429296706CA6351ULL,
+                                                 (long long)0xD5A79147C6E00BF3ULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        TMP = _mm_alignr_epi8(MSG3, MSG2, 4);
+        MSG0 = _mm_add_epi32(MSG0, TMP);
+        MSG0 = _mm_sha256msg2_epu32(MSG0, MSG3);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        MSG2 = _mm_sha256msg1_epu32(MSG2, MSG3);
+
+        /* Rounds 32-35 */
+        MSG = _mm_add_epi32(MSG0, _mm_set_epi64x((long long)0x53380D134D2C6DFCULL,
+                                                 (long long)0x2E1B213827B70A85ULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        TMP = _mm_alignr_epi8(MSG0, MSG3, 4);
+        MSG1 = _mm_add_epi32(MSG1, TMP);
+        MSG1 = _mm_sha256msg2_epu32(MSG1, MSG0);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        MSG3 = _mm_sha256msg1_epu32(MSG3, MSG0);
+
+        /* Rounds 36-39 */
+        MSG = _mm_add_epi32(MSG1, _mm_set_epi64x((long long)0x92722C8581C2C92EULL,
+                                                 (long long)0x766A0ABB650A7354ULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        TMP = _mm_alignr_epi8(MSG1, MSG0, 4);
+        MSG2 = _mm_add_epi32(MSG2, TMP);
+        MSG2 = _mm_sha256msg2_epu32(MSG2, MSG1);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        MSG0 = _mm_sha256msg1_epu32(MSG0, MSG1);
+
+        /* Rounds 40-43 */
+        MSG = _mm_add_epi32(MSG2, _mm_set_epi64x((long long)0xC76C51A3C24B8B70ULL,
+                                                 (long long)0xA81A664BA2BFE8A1ULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        TMP = _mm_alignr_epi8(MSG2, MSG1, 4);
+        MSG3 = _mm_add_epi32(MSG3, TMP);
+        MSG3 = _mm_sha256msg2_epu32(MSG3, MSG2);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        MSG1 = _mm_sha256msg1_epu32(MSG1, MSG2);
+
+        /* Rounds 44-47 */
+        MSG = _mm_add_epi32(MSG3, _mm_set_epi64x((long long)0x106AA070F40E3585ULL,
+                                                 (long long)0xD6990624D192E819ULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        TMP = _mm_alignr_epi8(MSG3, MSG2, 4);
+        MSG0 = _mm_add_epi32(MSG0, TMP);
+        MSG0 = _mm_sha256msg2_epu32(MSG0, MSG3);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        MSG2 = _mm_sha256msg1_epu32(MSG2, MSG3);
+
+        /* Rounds 48-51 */
+        MSG = _mm_add_epi32(MSG0, _mm_set_epi64x((long long)0x34B0BCB52748774CULL,
+                                                 (long long)0x1E376C0819A4C116ULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        TMP = _mm_alignr_epi8(MSG0, MSG3, 4);
+        MSG1 = _mm_add_epi32(MSG1, TMP);
+        MSG1 = _mm_sha256msg2_epu32(MSG1, MSG0);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        MSG3 = _mm_sha256msg1_epu32(MSG3, MSG0);
+
+        /* Rounds 52-55 */
+        MSG = _mm_add_epi32(MSG1, _mm_set_epi64x((long long)0x682E6FF35B9CCA4FULL,
+                                                 (long long)0x4ED8AA4A391C0CB3ULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        TMP = _mm_alignr_epi8(MSG1, MSG0, 4);
+        MSG2 = _mm_add_epi32(MSG2, TMP);
+        MSG2 = _mm_sha256msg2_epu32(MSG2, MSG1);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+
+        /* Rounds 56-59 */
+        MSG = _mm_add_epi32(MSG2, _mm_set_epi64x((long long)0x8CC7020884C87814ULL,
+                                                 (long long)0x78A5636F748F82EEULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        TMP = _mm_alignr_epi8(MSG2, MSG1, 4);
+        MSG3 = _mm_add_epi32(MSG3, TMP);
+        MSG3 = _mm_sha256msg2_epu32(MSG3, MSG2);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+
+        /* Rounds 60-63 */
+        MSG = _mm_add_epi32(MSG3, _mm_set_epi64x((long long)0xC67178F2BEF9A3F7ULL,
+                                                 (long long)0xA4506CEB90BEFFFAULL));
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+        MSG = _mm_shuffle_epi32(MSG, 0x0E);
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+
+        STATE0 = _mm_add_epi32(STATE0, ABEF_SAVE);
+        STATE1 = _mm_add_epi32(STATE1, CDGH_SAVE);
+
+        data += 64;
+        nblocks--;
+    }
+
+    /* De-interleave and store state */
+    TMP = _mm_shuffle_epi32(STATE0, 0x1B);       /* FEBA */
+    STATE1 = _mm_shuffle_epi32(STATE1, 0xB1);    /* DCHG */
+    STATE0 = _mm_blend_epi16(TMP, STATE1, 0xF0); /* DCBA */
+    STATE1 = _mm_alignr_epi8(STATE1, TMP, 8);    /* HGFE */
+    _mm_storeu_si128((__m128i *)(void *)&state[0], STATE0);
+    _mm_storeu_si128((__m128i *)(void *)&state[4], STATE1);
+}
+
+/**
+ * @brief CPUID check for the x86 SHA extensions
+ */
+static bool sha256_hw_available(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+    }
+    return (ebx & (1U << 29)) != 0;  /* CPUID.7.0:EBX.SHA[bit 29] */
+}
+
+#elif defined(CB_SHA_ACCEL_ARM)
+
+/**
+ * @brief Multi-block SHA-256 compression using ARMv8 Crypto Extensions
+ */
+__attribute__((target("+crypto")))
+static void sha256_transform_hw(uint32_t state[8], const uint8_t *data,
+                                uint32_t nblocks)
+{
+    uint32x4_t STATE0 = vld1q_u32(&state[0]);
+    uint32x4_t STATE1 = vld1q_u32(&state[4]);
+
+    while (nblocks > 0) {
+        uint32x4_t MSG0, MSG1, MSG2, MSG3;
+        uint32x4_t TMP0, TMP1, TMP2;
+        uint32x4_t S0_SAVE = STATE0;
+        uint32x4_t S1_SAVE = STATE1;
+
+        MSG0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 0)));
+        MSG1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16)));
+        MSG2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 32)));
+        MSG3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 48)));
+
+        TMP0 = vaddq_u32(MSG0, vld1q_u32(&K[0]));
+
+        /* Rounds 0-3 */
+        MSG0 = vsha256su0q_u32(MSG0, MSG1);
+        TMP2 = STATE0;
+        TMP1 = vaddq_u32(MSG1, vld1q_u32(&K[4]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP0);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP0);
+        MSG0 = vsha256su1q_u32(MSG0, MSG2, MSG3);
+
+        /* Rounds 4-7 */
+        MSG1 = vsha256su0q_u32(MSG1, MSG2);
+        TMP2 = STATE0;
+        TMP0 = vaddq_u32(MSG2, vld1q_u32(&K[8]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP1);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP1);
+        MSG1 = vsha256su1q_u32(MSG1, MSG3, MSG0);
+
+        /* Rounds 8-11 */
+        MSG2 = vsha256su0q_u32(MSG2, MSG3);
+        TMP2 = STATE0;
+        TMP1 = vaddq_u32(MSG3, vld1q_u32(&K[12]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP0);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP0);
+        MSG2 = vsha256su1q_u32(MSG2, MSG0, MSG1);
+
+        /* Rounds 12-15 */
+        MSG3 = vsha256su0q_u32(MSG3, MSG0);
+        TMP2 = STATE0;
+        TMP0 = vaddq_u32(MSG0, vld1q_u32(&K[16]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP1);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP1);
+        MSG3 = vsha256su1q_u32(MSG3, MSG1, MSG2);
+
+        /* Rounds 16-19 */
+        MSG0 = vsha256su0q_u32(MSG0, MSG1);
+        TMP2 = STATE0;
+        TMP1 = vaddq_u32(MSG1, vld1q_u32(&K[20]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP0);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP0);
+        MSG0 = vsha256su1q_u32(MSG0, MSG2, MSG3);
+
+        /* Rounds 20-23 */
+        MSG1 = vsha256su0q_u32(MSG1, MSG2);
+        TMP2 = STATE0;
+        TMP0 = vaddq_u32(MSG2, vld1q_u32(&K[24]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP1);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP1);
+        MSG1 = vsha256su1q_u32(MSG1, MSG3, MSG0);
+
+        /* Rounds 24-27 */
+        MSG2 = vsha256su0q_u32(MSG2, MSG3);
+        TMP2 = STATE0;
+        TMP1 = vaddq_u32(MSG3, vld1q_u32(&K[28]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP0);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP0);
+        MSG2 = vsha256su1q_u32(MSG2, MSG0, MSG1);
+
+        /* Rounds 28-31 */
+        MSG3 = vsha256su0q_u32(MSG3, MSG0);
+        TMP2 = STATE0;
+        TMP0 = vaddq_u32(MSG0, vld1q_u32(&K[32]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP1);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP1);
+        MSG3 = vsha256su1q_u32(MSG3, MSG1, MSG2);
+
+        /* Rounds 32-35 */
+        MSG0 = vsha256su0q_u32(MSG0, MSG1);
+        TMP2 = STATE0;
+        TMP1 = vaddq_u32(MSG1, vld1q_u32(&K[36]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP0);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP0);
+        MSG0 = vsha256su1q_u32(MSG0, MSG2, MSG3);
+
+        /* Rounds 36-39 */
+        MSG1 = vsha256su0q_u32(MSG1, MSG2);
+        TMP2 = STATE0;
+        TMP0 = vaddq_u32(MSG2, vld1q_u32(&K[40]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP1);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP1);
+        MSG1 = vsha256su1q_u32(MSG1, MSG3, MSG0);
+
+        /* Rounds 40-43 */
+        MSG2 = vsha256su0q_u32(MSG2, MSG3);
+        TMP2 = STATE0;
+        TMP1 = vaddq_u32(MSG3, vld1q_u32(&K[44]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP0);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP0);
+        MSG2 = vsha256su1q_u32(MSG2, MSG0, MSG1);
+
+        /* Rounds 44-47 */
+        MSG3 = vsha256su0q_u32(MSG3, MSG0);
+        TMP2 = STATE0;
+        TMP0 = vaddq_u32(MSG0, vld1q_u32(&K[48]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP1);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP1);
+        MSG3 = vsha256su1q_u32(MSG3, MSG1, MSG2);
+
+        /* Rounds 48-51 */
+        TMP2 = STATE0;
+        TMP1 = vaddq_u32(MSG1, vld1q_u32(&K[52]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP0);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP0);
+
+        /* Rounds 52-55 */
+        TMP2 = STATE0;
+        TMP0 = vaddq_u32(MSG2, vld1q_u32(&K[56]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP1);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP1);
+
+        /* Rounds 56-59 */
+        TMP2 = STATE0;
+        TMP1 = vaddq_u32(MSG3, vld1q_u32(&K[60]));
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP0);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP0);
+
+        /* Rounds 60-63 */
+        TMP2 = STATE0;
+        STATE0 = vsha256hq_u32(STATE0, STATE1, TMP1);
+        STATE1 = vsha256h2q_u32(STATE1, TMP2, TMP1);
+
+        STATE0 = vaddq_u32(STATE0, S0_SAVE);
+        STATE1 = vaddq_u32(STATE1, S1_SAVE);
+
+        data += 64;
+        nblocks--;
+    }
+
+    vst1q_u32(&state[0], STATE0);
+    vst1q_u32(&state[4], STATE1);
+}
+
+/**
+ * @brief HWCAP check for the ARMv8 SHA2 extension
+ */
+static bool sha256_hw_available(void)
+{
+    return (getauxval(AT_HWCAP) & HWCAP_SHA2) != 0;
+}
+
+#endif /* CB_SHA_ACCEL_* */
+
+/**
+ * @brief Process a run of full blocks through the fastest available path
+ */
+static void sha256_blocks(uint32_t state[8], const uint8_t *data, uint32_t nblocks)
+{
+#if defined(CB_SHA_ACCEL_X86) || defined(CB_SHA_ACCEL_ARM)
+    if (g_sha_accel < 0) {
+        g_sha_accel = sha256_hw_available() ? 1 : 0;
+    }
+    if (g_sha_accel == 1) {
+        sha256_transform_hw(state, data, nblocks);
+        return;
+    }
+#endif
+    while (nblocks > 0) {
+        sha256_transform(state, data);
+        data += 64;
+        nblocks--;
+    }
+}
+
+bool cb_verify_accel_available(void)
+{
+#if defined(CB_SHA_ACCEL_X86) || defined(CB_SHA_ACCEL_ARM)
+    if (g_sha_accel < 0) {
+        g_sha_accel = sha256_hw_available() ? 1 : 0;
+    }
+    return g_sha_accel == 1;
+#else
+    return false;
+#endif
+}
+
+void cb_verify_set_accel(bool enable)
+{
+#if defined(CB_SHA_ACCEL_X86) || defined(CB_SHA_ACCEL_ARM)
+    if (!enable) {
+        g_sha_accel = 0;
+    } else {
+        g_sha_accel = sha256_hw_available() ? 1 : 0;
+    }
+#else
+    (void)enable;
+#endif
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Internal SHA-256 Functions
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -136,16 +599,17 @@ static void sha256_update(sha256_state_t *s, const uint8_t *data, uint32_t len)
             return;
         }
         memcpy(s->buffer + s->buffer_len, data, remaining);
-        sha256_transform(s->h, s->buffer);
+        sha256_blocks(s->h, s->buffer, 1);
         data += remaining;
         len -= remaining;
         s->buffer_len = 0;
     }
 
-    while (len >= 64) {
-        sha256_transform(s->h, data);
-        data += 64;
-        len -= 64;
+    if (len >= 64) {
+        uint32_t nblocks = len / 64;
+        sha256_blocks(s->h, data, nblocks);
+        data += (uint32_t)(nblocks * 64);
+        len -= (uint32_t)(nblocks * 64);
     }
 
     if (len > 0) {
@@ -235,6 +699,251 @@ cb_result_code_t cb_compute_hash(const void *data, uint32_t size, cb_hash_t *has
     return CB_OK;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Chunked Hash Tree (SRS-004-VERIFY §4.7, CB-MATH-001 §8.4)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Hash a contiguous range of chunks
+ *
+ * Each chunk digest covers only that chunk's bytes, so ranges can be
+ * hashed on any thread in any order and still agree with the serial
+ * path bit-for-bit.
+ */
+static void hash_chunk_range(const uint8_t *base,
+                             uint64_t size,
+                             uint32_t chunk_size,
+                             cb_hash_t *chunk_hashes,
+                             uint32_t first,
+                             uint32_t count)
+{
+    uint32_t c;
+    uint64_t offset;
+    uint32_t len;
+
+    for (c = first; c < first + count; c++) {
+        offset = (uint64_t)c * chunk_size;
+        len = (size - offset < chunk_size) ? (uint32_t)(size - offset)
+                                           : chunk_size;
+        (void)cb_compute_hash(base + offset, len, &chunk_hashes[c]);
+    }
+}
+
+/**
+ * @brief Worker arguments for parallel chunk hashing
+ */
+typedef struct {
+    const uint8_t *base;       /**< Buffer being hashed */
+    uint64_t size;             /**< Total buffer size */
+    uint32_t chunk_size;       /**< Chunk size in bytes */
+    uint32_t first;            /**< First chunk of this worker's range */
+    uint32_t count;            /**< Chunks in this worker's range */
+    uint32_t _padding;
+    cb_hash_t *chunk_hashes;   /**< Shared digest array (disjoint slots) */
+} hash_worker_args_t;
+
+/**
+ * @brief Worker thread body: hash one contiguous chunk range
+ */
+static void *hash_worker_main(void *arg)
+{
+    hash_worker_args_t *args = (hash_worker_args_t *)arg;
+
+    hash_chunk_range(args->base, args->size, args->chunk_size,
+                     args->chunk_hashes, args->first, args->count);
+    return NULL;
+}
+
+/**
+ * @brief Validate chunking parameters and compute the chunk count
+ */
+static cb_result_code_t chunk_count(uint64_t size,
+                                    uint32_t chunk_size,
+                                    uint32_t capacity,
+                                    uint32_t *num_chunks)
+{
+    uint64_t n;
+
+    if (size == 0 || chunk_size == 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    n = (size + chunk_size - 1) / chunk_size;
+    if (n > capacity) {
+        return CB_ERR_OUT_OF_MEMORY;
+    }
+
+    *num_chunks = (uint32_t)n;
+    return CB_OK;
+}
+
+/**
+ * @brief Hash fixed-size chunks of a buffer independently
+ * @satisfies VERIFY-F-060, VERIFY-F-061
+ */
+cb_result_code_t cb_hash_chunks(const void *data,
+                                uint64_t size,
+                                uint32_t chunk_size,
+                                cb_hash_t *chunk_hashes,
+                                uint32_t capacity,
+                                uint32_t *num_chunks)
+{
+    cb_result_code_t rc;
+
+    if (data == NULL || chunk_hashes == NULL || num_chunks == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    rc = chunk_count(size, chunk_size, capacity, num_chunks);
+    if (rc != CB_OK) {
+        return rc;
+    }
+
+    hash_chunk_range((const uint8_t *)data, size, chunk_size,
+                     chunk_hashes, 0, *num_chunks);
+    return CB_OK;
+}
+
+/**
+ * @brief Hash chunks in parallel across worker threads
+ * @satisfies VERIFY-F-062
+ */
+cb_result_code_t cb_hash_chunks_parallel(const void *data,
+                                         uint64_t size,
+                                         uint32_t chunk_size,
+                                         uint32_t num_threads,
+                                         cb_hash_t *chunk_hashes,
+                                         uint32_t capacity,
+                                         uint32_t *num_chunks)
+{
+    static pthread_t threads[CB_HASH_MAX_THREADS];
+    static hash_worker_args_t args[CB_HASH_MAX_THREADS];
+    cb_result_code_t rc;
+    uint32_t n, t, per_worker, remainder, next;
+
+    if (data == NULL || chunk_hashes == NULL || num_chunks == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    rc = chunk_count(size, chunk_size, capacity, num_chunks);
+    if (rc != CB_OK) {
+        return rc;
+    }
+    n = *num_chunks;
+
+    if (num_threads > CB_HASH_MAX_THREADS) {
+        num_threads = CB_HASH_MAX_THREADS;
+    }
+    if (num_threads > n) {
+        num_threads = n;
+    }
+    if (num_threads <= 1) {
+        hash_chunk_range((const uint8_t *)data, size, chunk_size,
+                         chunk_hashes, 0, n);
+        return CB_OK;
+    }
+
+    /* Contiguous ranges of ⌈n/T⌉ or ⌊n/T⌋ chunks; each worker writes
+     * only its own disjoint slots, so no synchronisation is needed */
+    per_worker = n / num_threads;
+    remainder = n % num_threads;
+    next = 0;
+
+    for (t = 0; t < num_threads; t++) {
+        args[t].base = (const uint8_t *)data;
+        args[t].size = size;
+        args[t].chunk_size = chunk_size;
+        args[t].first = next;
+        args[t].count = per_worker + ((t < remainder) ? 1U : 0U);
+        args[t].chunk_hashes = chunk_hashes;
+        next += args[t].count;
+
+        if (pthread_create(&threads[t], NULL, hash_worker_main,
+                           &args[t]) != 0) {
+            /* Finish the remaining range on this thread rather than
+             * fail the whole operation, then join what was started */
+            hash_chunk_range((const uint8_t *)data, size, chunk_size,
+                             chunk_hashes, args[t].first, n - args[t].first);
+            num_threads = t;
+            break;
+        }
+    }
+
+    for (t = 0; t < num_threads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    return CB_OK;
+}
+
+/**
+ * @brief Combine chunk hashes into a single tree root
+ * @satisfies VERIFY-F-063
+ */
+cb_result_code_t cb_hash_tree_root(const cb_hash_t *chunk_hashes,
+                                   uint32_t num_chunks,
+                                   cb_hash_t *root)
+{
+    cb_verify_ctx_t ctx;
+    uint8_t le64_buf[8];
+    uint32_t c;
+    static const char prefix[] = "CB:TREE:v1";
+
+    if (chunk_hashes == NULL || root == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+    if (num_chunks == 0) {
+        return CB_ERR_INVALID_CONFIG;
+    }
+
+    /* Root = SHA256(prefix || LE64(count) || digests); the count in
+     * the preimage prevents truncation collisions */
+    cb_verify_ctx_init(&ctx);
+    cb_verify_ctx_update(&ctx, prefix, (uint32_t)strlen(prefix));
+
+    le64_buf[0] = (uint8_t)(num_chunks);
+    le64_buf[1] = (uint8_t)(num_chunks >> 8);
+    le64_buf[2] = (uint8_t)(num_chunks >> 16);
+    le64_buf[3] = (uint8_t)(num_chunks >> 24);
+    le64_buf[4] = 0;
+    le64_buf[5] = 0;
+    le64_buf[6] = 0;
+    le64_buf[7] = 0;
+    cb_verify_ctx_update(&ctx, le64_buf, 8);
+
+    for (c = 0; c < num_chunks; c++) {
+        cb_verify_ctx_update(&ctx, chunk_hashes[c].bytes, CB_HASH_SIZE);
+    }
+
+    cb_verify_ctx_final(&ctx, root);
+    return CB_OK;
+}
+
+/**
+ * @brief Find the first diverging chunk between two hash arrays
+ * @satisfies VERIFY-F-064
+ */
+cb_result_code_t cb_hash_chunks_diff(const cb_hash_t *a,
+                                     const cb_hash_t *b,
+                                     uint32_t num_chunks,
+                                     uint32_t *first_diverging)
+{
+    uint32_t c;
+
+    if (a == NULL || b == NULL || first_diverging == NULL) {
+        return CB_ERR_NULL_PTR;
+    }
+
+    *first_diverging = UINT32_MAX;
+    for (c = 0; c < num_chunks; c++) {
+        if (!cb_hash_equal(&a[c], &b[c])) {
+            *first_diverging = c;
+            break;
+        }
+    }
+    return CB_OK;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Hash Comparison (constant-time)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -358,6 +1067,17 @@ cb_result_code_t cb_golden_load(const char *path, cb_golden_ref_t *golden)
         golden->output_size = (uint32_t)tmp;
 
     extract_json_string(json, "platform", golden->platform, sizeof(golden->platform));
+
+    /* Chunked tree fields (§4.7) — optional; goldens generated before
+     * chunked hashing simply leave them zero */
+    if (extract_json_string(json, "tree_root", hash_hex, sizeof(hash_hex))) {
+        if (cb_hash_from_hex(hash_hex, &golden->tree_root) != CB_OK)
+            return CB_ERR_GOLDEN_LOAD;
+        if (extract_json_uint(json, "chunk_size", &tmp))
+            golden->chunk_size = (uint32_t)tmp;
+        if (extract_json_uint(json, "num_chunks", &tmp))
+            golden->num_chunks = (uint32_t)tmp;
+    }
     return CB_OK;
 }
 
@@ -384,6 +1104,12 @@ cb_result_code_t cb_golden_save(const char *path, const cb_golden_ref_t *golden)
     fprintf(fp, "  \"output_hash\": \"%s\",\n", hash_hex);
     fprintf(fp, "  \"sample_count\": %u,\n", golden->sample_count);
     fprintf(fp, "  \"output_size\": %u,\n", golden->output_size);
+    if (golden->chunk_size > 0) {
+        cb_hash_to_hex(&golden->tree_root, hash_hex);
+        fprintf(fp, "  \"tree_root\": \"%s\",\n", hash_hex);
+        fprintf(fp, "  \"chunk_size\": %u,\n", golden->chunk_size);
+        fprintf(fp, "  \"num_chunks\": %u,\n", golden->num_chunks);
+    }
     fprintf(fp, "  \"platform\": \"%s\"\n", golden->platform);
     fprintf(fp, "}\n");
     fclose(fp);
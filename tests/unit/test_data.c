@@ -0,0 +1,309 @@
+/**
+ * @file test_data.c
+ * @brief Unit tests for cb_data API
+ *
+ * Tests zero-copy mapping, content verification, and slice views
+ * against all SRS-007-DATA requirements.
+ *
+ * @traceability SRS-007-DATA §10
+ *
+ * Copyright © 2026 The Murray Family Innovation Trust. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "cb_data.h"
+#include "cb_verify.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test Infrastructure
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+static int g_tests_run = 0;
+static int g_tests_passed = 0;
+static int g_tests_failed = 0;
+
+#define TEST_ASSERT(cond, msg) do { \
+    g_tests_run++; \
+    if (!(cond)) { \
+        printf("    FAIL: %s\n", msg); \
+        printf("          at %s:%d\n", __FILE__, __LINE__); \
+        g_tests_failed++; \
+        return -1; \
+    } else { \
+        g_tests_passed++; \
+    } \
+} while(0)
+
+#define TEST_ASSERT_EQ(a, b, msg) TEST_ASSERT((a) == (b), msg)
+#define TEST_ASSERT_NE(a, b, msg) TEST_ASSERT((a) != (b), msg)
+
+#define RUN_TEST(fn) do { \
+    printf("  %s\n", #fn); \
+    int result = fn(); \
+    if (result == 0) { \
+        printf("    PASS\n"); \
+    } \
+} while(0)
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Fixture: deterministic corpus file of fixed-size records
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#define TEST_RECORD_SIZE  64
+#define TEST_NUM_RECORDS  32
+#define TEST_CORPUS_SIZE  (TEST_RECORD_SIZE * TEST_NUM_RECORDS)
+
+static const char *g_corpus_path = "/tmp/cb_test_corpus.bin";
+static uint8_t g_corpus[TEST_CORPUS_SIZE];
+
+static int write_corpus(void)
+{
+    FILE *fp;
+    uint32_t i;
+
+    for (i = 0; i < TEST_CORPUS_SIZE; i++) {
+        g_corpus[i] = (uint8_t)(i * 13 + 5);
+    }
+
+    fp = fopen(g_corpus_path, "wb");
+    if (fp == NULL) {
+        return -1;
+    }
+    if (fwrite(g_corpus, 1, TEST_CORPUS_SIZE, fp) != TEST_CORPUS_SIZE) {
+        fclose(fp);
+        return -1;
+    }
+    fclose(fp);
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Mapping Lifecycle (SRS-007-DATA §4.1)
+ * Traceability: DATA-F-001 through DATA-F-005
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Test mapping reflects the file contents without copying
+ * @satisfies DATA-F-001, DATA-F-002
+ */
+static int test_map_contents(void)
+{
+    cb_data_map_t map;
+    cb_result_code_t rc;
+
+    rc = cb_data_map(&map, g_corpus_path, false);
+    TEST_ASSERT_EQ(rc, CB_OK, "map should succeed");
+    TEST_ASSERT(map.mapped, "mapping marked live");
+    TEST_ASSERT_EQ(map.size, TEST_CORPUS_SIZE, "size matches the file");
+    TEST_ASSERT(memcmp(map.base, g_corpus, TEST_CORPUS_SIZE) == 0,
+                "mapped bytes match the file contents");
+
+    rc = cb_data_unmap(&map);
+    TEST_ASSERT_EQ(rc, CB_OK, "unmap should succeed");
+    TEST_ASSERT(!map.mapped, "descriptor reset after unmap");
+
+    return 0;
+}
+
+/**
+ * @brief Test prefaulted mapping is identical in content
+ * @satisfies DATA-F-003
+ */
+static int test_map_prefault(void)
+{
+    cb_data_map_t map;
+    cb_result_code_t rc;
+
+    rc = cb_data_map(&map, g_corpus_path, true);
+    TEST_ASSERT_EQ(rc, CB_OK, "prefaulted map should succeed");
+    TEST_ASSERT(map.prefaulted, "prefault recorded");
+    TEST_ASSERT(memcmp(map.base, g_corpus, TEST_CORPUS_SIZE) == 0,
+                "prefaulted bytes match the file contents");
+
+    cb_data_unmap(&map);
+    return 0;
+}
+
+/**
+ * @brief Test mapping failure modes
+ * @satisfies DATA-F-004, DATA-F-005
+ */
+static int test_map_invalid(void)
+{
+    cb_data_map_t map;
+
+    TEST_ASSERT_EQ(cb_data_map(NULL, g_corpus_path, false),
+                   CB_ERR_NULL_PTR, "NULL map rejected");
+    TEST_ASSERT_EQ(cb_data_map(&map, NULL, false),
+                   CB_ERR_NULL_PTR, "NULL path rejected");
+    TEST_ASSERT_EQ(cb_data_map(&map, "/nonexistent/corpus.bin", false),
+                   CB_ERR_DATA_LOAD, "missing file rejected");
+
+    TEST_ASSERT_EQ(cb_data_unmap(NULL), CB_ERR_NULL_PTR,
+                   "NULL unmap rejected");
+    memset(&map, 0, sizeof(map));
+    TEST_ASSERT_EQ(cb_data_unmap(&map), CB_ERR_INVALID_CONFIG,
+                   "unmap of dead mapping rejected");
+
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Content Verification (SRS-007-DATA §4.2)
+ * Traceability: DATA-F-010, DATA-F-011
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Test content hash verification at map time
+ * @satisfies DATA-F-010, DATA-F-011
+ */
+static int test_verify_content(void)
+{
+    cb_data_map_t map;
+    cb_hash_t expected;
+
+    cb_compute_hash(g_corpus, TEST_CORPUS_SIZE, &expected);
+
+    TEST_ASSERT_EQ(cb_data_map(&map, g_corpus_path, false), CB_OK,
+                   "map should succeed");
+    TEST_ASSERT_EQ(cb_data_verify(&map, &expected), CB_OK,
+                   "matching content hash verifies");
+
+    /* A corrupted expectation must be detected */
+    expected.bytes[0] ^= 0x01;
+    TEST_ASSERT_EQ(cb_data_verify(&map, &expected), CB_ERR_VERIFICATION,
+                   "mismatched content hash rejected");
+
+    TEST_ASSERT_EQ(cb_data_verify(NULL, &expected), CB_ERR_NULL_PTR,
+                   "NULL map rejected");
+    TEST_ASSERT_EQ(cb_data_verify(&map, NULL), CB_ERR_NULL_PTR,
+                   "NULL hash rejected");
+
+    cb_data_unmap(&map);
+    TEST_ASSERT_EQ(cb_data_verify(&map, &expected), CB_ERR_INVALID_CONFIG,
+                   "verify of dead mapping rejected");
+
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Slice Views (SRS-007-DATA §4.3)
+ * Traceability: DATA-F-020 through DATA-F-022
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Test slice views point into the mapping, zero-copy
+ * @satisfies DATA-F-020, DATA-F-021
+ */
+static int test_slice_views(void)
+{
+    cb_data_map_t map;
+    const void *slice;
+    uint32_t r;
+
+    TEST_ASSERT_EQ(cb_data_map(&map, g_corpus_path, false), CB_OK,
+                   "map should succeed");
+    TEST_ASSERT_EQ(cb_data_num_records(&map, TEST_RECORD_SIZE),
+                   TEST_NUM_RECORDS, "record count from size / stride");
+
+    for (r = 0; r < TEST_NUM_RECORDS; r++) {
+        TEST_ASSERT_EQ(cb_data_slice(&map, r, TEST_RECORD_SIZE, &slice),
+                       CB_OK, "in-range slice should succeed");
+        TEST_ASSERT(memcmp(slice, g_corpus + r * TEST_RECORD_SIZE,
+                           TEST_RECORD_SIZE) == 0,
+                    "slice matches its record bytes");
+    }
+
+    /* Zero-copy: the slice points into the mapping itself */
+    cb_data_slice(&map, 3, TEST_RECORD_SIZE, &slice);
+    TEST_ASSERT_EQ((const uint8_t *)slice,
+                   (const uint8_t *)map.base + 3 * TEST_RECORD_SIZE,
+                   "slice is a view, not a copy");
+
+    cb_data_unmap(&map);
+    return 0;
+}
+
+/**
+ * @brief Test slice bounds checking and argument validation
+ * @satisfies DATA-F-022
+ */
+static int test_slice_bounds(void)
+{
+    cb_data_map_t map;
+    const void *slice;
+
+    TEST_ASSERT_EQ(cb_data_map(&map, g_corpus_path, false), CB_OK,
+                   "map should succeed");
+
+    TEST_ASSERT_EQ(cb_data_slice(&map, TEST_NUM_RECORDS, TEST_RECORD_SIZE,
+                                 &slice),
+                   CB_ERR_INVALID_CONFIG, "one-past-end slice rejected");
+    TEST_ASSERT_EQ(cb_data_slice(&map, UINT64_MAX, TEST_RECORD_SIZE, &slice),
+                   CB_ERR_INVALID_CONFIG, "huge index rejected, no wrap");
+    TEST_ASSERT_EQ(cb_data_slice(&map, 0, 0, &slice),
+                   CB_ERR_INVALID_CONFIG, "zero record size rejected");
+    TEST_ASSERT_EQ(cb_data_slice(&map, 0, TEST_RECORD_SIZE, NULL),
+                   CB_ERR_NULL_PTR, "NULL slice out rejected");
+    TEST_ASSERT_EQ(cb_data_num_records(&map, 0), 0,
+                   "zero record size has zero records");
+
+    /* A stride that does not divide the file drops the partial tail */
+    TEST_ASSERT_EQ(cb_data_num_records(&map, TEST_RECORD_SIZE + 1),
+                   TEST_CORPUS_SIZE / (TEST_RECORD_SIZE + 1),
+                   "partial tail record excluded");
+
+    cb_data_unmap(&map);
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Main Test Runner
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+int main(void)
+{
+    printf("═══════════════════════════════════════════════════════════════════\n");
+    printf(" certifiable-bench Data Tests\n");
+    printf(" @traceability SRS-007-DATA\n");
+    printf("═══════════════════════════════════════════════════════════════════\n");
+
+    if (write_corpus() != 0) {
+        printf("FATAL: cannot create test corpus at %s\n", g_corpus_path);
+        return 1;
+    }
+
+    printf("\n§4.1 Mapping Lifecycle (DATA-F-001..005)\n");
+    RUN_TEST(test_map_contents);
+    RUN_TEST(test_map_prefault);
+    RUN_TEST(test_map_invalid);
+
+    printf("\n§4.2 Content Verification (DATA-F-010..011)\n");
+    RUN_TEST(test_verify_content);
+
+    printf("\n§4.3 Slice Views (DATA-F-020..022)\n");
+    RUN_TEST(test_slice_views);
+    RUN_TEST(test_slice_bounds);
+
+    remove(g_corpus_path);
+
+    printf("\n═══════════════════════════════════════════════════════════════════\n");
+    printf(" Results\n");
+    printf("═══════════════════════════════════════════════════════════════════\n");
+    printf(" Tests run:    %d\n", g_tests_run);
+    printf(" Tests passed: %d\n", g_tests_passed);
+    printf(" Tests failed: %d\n", g_tests_failed);
+    printf("═══════════════════════════════════════════════════════════════════\n");
+
+    if (g_tests_failed > 0) {
+        printf("\n*** FAILURES DETECTED ***\n");
+        return 1;
+    }
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
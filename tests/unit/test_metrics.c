@@ -219,6 +219,80 @@ static int test_sort_large(void)
     return 0;
 }
 
+/**
+ * @brief Test cb_sort_u64_radix matches comparison sort
+ */
+static int test_sort_radix_matches(void)
+{
+    static uint64_t radix_arr[10000];
+    static uint64_t heap_arr[10000];
+    static uint64_t scratch[10000];
+    uint64_t seed = 0x12345678ULL;
+    uint32_t i;
+
+    /* Deterministic LCG covering a wide dynamic range */
+    for (i = 0; i < 10000; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        radix_arr[i] = seed >> (i % 48);
+        heap_arr[i] = radix_arr[i];
+    }
+
+    cb_sort_u64_radix(radix_arr, scratch, 10000);
+    cb_sort_u64(heap_arr, 10000);
+
+    for (i = 0; i < 10000; i++) {
+        TEST_ASSERT_EQ(radix_arr[i], heap_arr[i], "radix matches comparison sort");
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Test cb_sort_u64 radix path on counts above the threshold
+ */
+static int test_sort_radix_auto_path(void)
+{
+    static uint64_t arr[5000];
+    uint32_t i;
+
+    /* 5000 > RADIX_SORT_THRESHOLD — exercises the internal-scratch path */
+    for (i = 0; i < 5000; i++) {
+        arr[i] = 4999 - i;
+    }
+
+    cb_sort_u64(arr, 5000);
+
+    for (i = 0; i < 5000; i++) {
+        TEST_ASSERT_EQ(arr[i], i, "large array should be sorted");
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Test cb_sort_u64_radix edge cases
+ */
+static int test_sort_radix_edge(void)
+{
+    uint64_t arr[8] = {7, 7, 7, 7, 7, 7, 7, 7};
+    uint64_t scratch[8];
+    uint32_t i;
+
+    /* All equal — every pass is skipped */
+    cb_sort_u64_radix(arr, scratch, 8);
+    for (i = 0; i < 8; i++) {
+        TEST_ASSERT_EQ(arr[i], 7, "all-equal array unchanged");
+    }
+
+    /* NULL and trivial inputs must not crash */
+    cb_sort_u64_radix(NULL, scratch, 8);
+    cb_sort_u64_radix(arr, NULL, 8);
+    cb_sort_u64_radix(arr, scratch, 0);
+    cb_sort_u64_radix(arr, scratch, 1);
+
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Test: Percentile Computation (SRS-002-METRICS §4.3)
  * Test Vectors: CB-MATH-001 §10.2
@@ -302,6 +376,111 @@ static int test_percentile_null(void)
     return 0;
 }
 
+/**
+ * @brief Test cb_percentile_select matches the sort-based path
+ * @satisfies METRICS-F-030 through METRICS-F-036
+ */
+static int test_percentile_select_matches(void)
+{
+    static uint64_t sorted[10000];
+    static uint64_t selected[10000];
+    static uint64_t source[10000];
+    uint32_t n = 10000;
+    uint64_t seed = 0x5DEECE66DULL;
+    uint32_t i;
+    static const uint32_t pcts[] = {0, 1, 25, 50, 90, 95, 99, 100};
+    uint32_t p;
+
+    for (i = 0; i < n; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        source[i] = seed >> (i % 48);
+    }
+
+    memcpy(sorted, source, sizeof(source));
+    cb_sort_u64(sorted, n);
+
+    for (p = 0; p < sizeof(pcts) / sizeof(pcts[0]); p++) {
+        uint64_t expected = cb_percentile(sorted, n, pcts[p]);
+        memcpy(selected, source, sizeof(source));
+        TEST_ASSERT_EQ(cb_percentile_select(selected, n, pcts[p]), expected,
+                       "selection matches sort-based percentile");
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Test cb_percentile_select3 against cb_percentile
+ * @satisfies METRICS-F-030 through METRICS-F-036
+ */
+static int test_percentile_select3(void)
+{
+    static uint64_t sorted[5000];
+    static uint64_t selected[5000];
+    uint32_t n = 5000;
+    uint64_t seed = 0xDEADBEEFULL;
+    uint64_t p50, p95, p99;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        sorted[i] = seed >> 33;
+        selected[i] = sorted[i];
+    }
+
+    cb_sort_u64(sorted, n);
+
+    TEST_ASSERT_EQ(cb_percentile_select3(selected, n, &p50, &p95, &p99),
+                   CB_OK, "select3 succeeds");
+    TEST_ASSERT_EQ(p50, cb_percentile(sorted, n, 50), "p50 matches");
+    TEST_ASSERT_EQ(p95, cb_percentile(sorted, n, 95), "p95 matches");
+    TEST_ASSERT_EQ(p99, cb_percentile(sorted, n, 99), "p99 matches");
+
+    /* Small counts exercise the insertion-sort segment path */
+    {
+        uint64_t tiny[] = {300, 100, 200};
+        TEST_ASSERT_EQ(cb_percentile_select3(tiny, 3, &p50, &p95, &p99),
+                       CB_OK, "select3 tiny succeeds");
+        TEST_ASSERT_EQ(p50, 200, "tiny p50 = 200");
+    }
+    {
+        uint64_t one[] = {42};
+        TEST_ASSERT_EQ(cb_percentile_select3(one, 1, &p50, &p95, &p99),
+                       CB_OK, "select3 single succeeds");
+        TEST_ASSERT_EQ(p50, 42, "single p50 = 42");
+        TEST_ASSERT_EQ(p99, 42, "single p99 = 42");
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Test selection-based percentile error handling
+ */
+static int test_percentile_select_invalid(void)
+{
+    uint64_t samples[] = {1, 2, 3};
+    uint64_t p50, p95, p99;
+
+    TEST_ASSERT_EQ(cb_percentile_select(NULL, 3, 50), 0,
+                   "NULL samples returns 0");
+    TEST_ASSERT_EQ(cb_percentile_select(samples, 0, 50), 0,
+                   "count=0 returns 0");
+    TEST_ASSERT_EQ(cb_percentile_select(samples, 3, 200), 3,
+                   "percentile > 100 clamps to p100");
+
+    TEST_ASSERT_EQ(cb_percentile_select3(NULL, 3, &p50, &p95, &p99),
+                   CB_ERR_NULL_PTR, "NULL samples rejected");
+    TEST_ASSERT_EQ(cb_percentile_select3(samples, 3, NULL, &p95, &p99),
+                   CB_ERR_NULL_PTR, "NULL output rejected");
+    TEST_ASSERT_EQ(cb_percentile_select3(samples, 0, &p50, &p95, &p99),
+                   CB_OK, "count=0 yields zeros");
+    TEST_ASSERT_EQ(p50, 0, "count=0: p50 = 0");
+    TEST_ASSERT_EQ(p99, 0, "count=0: p99 = 0");
+
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Test: Basic Statistics (SRS-002-METRICS §4.1)
  * Traceability: METRICS-F-001 through METRICS-F-010
@@ -582,6 +761,140 @@ static int test_histogram_invalid(void)
     return 0;
 }
 
+/**
+ * @brief Test log histogram layout: contiguous, ascending, full range
+ */
+static int test_histogram_log_layout(void)
+{
+    cb_histogram_t hist;
+    static cb_histogram_bin_t bins[256];
+    cb_result_code_t rc;
+    uint32_t i;
+
+    rc = cb_histogram_init_log(&hist, bins, 256, 4);
+    TEST_ASSERT_EQ(rc, CB_OK, "log init should succeed");
+    TEST_ASSERT_EQ(hist.bin_width_ns, 0, "variable-width sentinel set");
+    TEST_ASSERT_EQ(hist.num_bins, 252, "4 sub-buckets over 63 regions");
+    TEST_ASSERT_EQ(hist.range_min_ns, 0, "range starts at 0");
+    TEST_ASSERT_EQ(hist.range_max_ns, UINT64_MAX, "full uint64 range");
+
+    /* Bins must tile the range with no gaps or overlaps */
+    TEST_ASSERT_EQ(bins[0].min_ns, 0, "first bin starts at 0");
+    for (i = 1; i < hist.num_bins; i++) {
+        TEST_ASSERT_EQ(bins[i].min_ns, bins[i - 1].max_ns, "bins contiguous");
+        TEST_ASSERT_GT(bins[i].max_ns, bins[i].min_ns, "bins non-empty");
+    }
+    TEST_ASSERT_EQ(bins[hist.num_bins - 1].max_ns, UINT64_MAX, "last bin clamped");
+
+    return 0;
+}
+
+/**
+ * @brief Test log histogram binning across a wide dynamic range
+ */
+static int test_histogram_log_binning(void)
+{
+    cb_histogram_t hist;
+    static cb_histogram_bin_t bins[256];
+    /* 2 µs body with a 40 ms tail — the case linear bins cannot resolve */
+    uint64_t samples[] = {0, 1, 3, 2000, 2100, 2500, 40000000, 40000001};
+    uint32_t total = 0;
+    uint32_t i, j;
+
+    cb_histogram_init_log(&hist, bins, 256, 4);
+    cb_result_code_t rc = cb_histogram_build(samples, 8, &hist);
+    TEST_ASSERT_EQ(rc, CB_OK, "build should succeed");
+
+    /* Every sample lands in exactly the bin whose bounds contain it */
+    for (i = 0; i < 8; i++) {
+        for (j = 0; j < hist.num_bins; j++) {
+            if (samples[i] >= bins[j].min_ns && samples[i] < bins[j].max_ns) {
+                TEST_ASSERT_GT(bins[j].count, 0, "containing bin non-empty");
+                break;
+            }
+        }
+    }
+
+    for (j = 0; j < hist.num_bins; j++) {
+        total += bins[j].count;
+    }
+    TEST_ASSERT_EQ(total, 8, "all samples binned");
+    TEST_ASSERT_EQ(hist.overflow_count, 0, "no overflow across full range");
+    TEST_ASSERT_EQ(hist.underflow_count, 0, "no underflow");
+
+    /* The 2 µs cluster and the 40 ms tail must occupy distinct bins */
+    {
+        uint32_t body_bin = 0, tail_bin = 0;
+        for (j = 0; j < hist.num_bins; j++) {
+            if (samples[3] >= bins[j].min_ns && samples[3] < bins[j].max_ns) body_bin = j;
+            if (samples[6] >= bins[j].min_ns && samples[6] < bins[j].max_ns) tail_bin = j;
+        }
+        TEST_ASSERT_GT(tail_bin, body_bin, "tail resolved separately from body");
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Test log histogram invalid config
+ */
+static int test_histogram_log_invalid(void)
+{
+    cb_histogram_t hist;
+    static cb_histogram_bin_t bins[256];
+    cb_result_code_t rc;
+
+    rc = cb_histogram_init_log(NULL, bins, 256, 4);
+    TEST_ASSERT_EQ(rc, CB_ERR_NULL_PTR, "NULL histogram");
+
+    rc = cb_histogram_init_log(&hist, NULL, 256, 4);
+    TEST_ASSERT_EQ(rc, CB_ERR_NULL_PTR, "NULL bins");
+
+    rc = cb_histogram_init_log(&hist, bins, 256, 3);
+    TEST_ASSERT_EQ(rc, CB_ERR_INVALID_CONFIG, "non power-of-two subbuckets");
+
+    rc = cb_histogram_init_log(&hist, bins, 256, 1);
+    TEST_ASSERT_EQ(rc, CB_ERR_INVALID_CONFIG, "subbuckets too small");
+
+    rc = cb_histogram_init_log(&hist, bins, 100, 4);
+    TEST_ASSERT_EQ(rc, CB_ERR_INVALID_CONFIG, "capacity too small");
+
+    return 0;
+}
+
+/**
+ * @brief Test reciprocal-multiply binning against the division form
+ * @satisfies METRICS-F-040, METRICS-NF-020
+ */
+static int test_histogram_reciprocal_exact(void)
+{
+    /* Awkward (non-power-of-two) width: 97 bins of width 13 over
+     * [5, 1266). One sample per value means every bin must hold
+     * exactly its width's worth — any off-by-one in the reciprocal
+     * fix-up shifts a boundary value into the wrong bin */
+    static cb_histogram_bin_t bins[97];
+    static uint64_t samples[1261];
+    cb_histogram_t histogram;
+    uint32_t i;
+
+    for (i = 0; i < 1261; i++) {
+        samples[i] = 5U + i;
+    }
+
+    TEST_ASSERT_EQ(cb_histogram_init(&histogram, bins, 97, 5, 1266),
+                   CB_OK, "init should succeed");
+    TEST_ASSERT_EQ(cb_histogram_build(samples, 1261, &histogram),
+                   CB_OK, "build should succeed");
+
+    for (i = 0; i < 97; i++) {
+        TEST_ASSERT_EQ(bins[i].count, 13, "bin count matches division form");
+    }
+    TEST_ASSERT_EQ(histogram.underflow_count, 0, "no underflow");
+    TEST_ASSERT_EQ(histogram.overflow_count, 0, "no overflow");
+
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Test: Outlier Detection (SRS-002-METRICS §4.5)
  * Test Vectors: CB-MATH-001 §10.3
@@ -696,6 +1009,260 @@ static int test_outliers_empty(void)
     return 0;
 }
 
+/**
+ * @brief Test cutoff scan against the division-form reference
+ * @satisfies METRICS-F-052, METRICS-NF-021
+ *
+ * The dispatched (possibly SIMD) flagging pass must reproduce the
+ * modified-Z division form flag for flag, including values exactly at
+ * the 3.5σ threshold.
+ */
+static int test_outliers_cutoff_equivalence(void)
+{
+    static uint64_t samples[1024];
+    static uint64_t sorted[1024];
+    static bool outlier_flags[1024];
+    uint64_t median, mad, deviation, z_scaled;
+    uint32_t outlier_count, reference_count = 0;
+    uint32_t i;
+
+    /* Deterministic body with a sprinkling of extremes, length chosen
+     * to exercise both the vector body and the scalar tail */
+    for (i = 0; i < 1024; i++) {
+        samples[i] = 1000 + (uint64_t)((i * 7919) % 200);
+    }
+    samples[3] = 90000;      /* Clear outliers */
+    samples[511] = 150000;
+    samples[1023] = 1;       /* Low-side outlier */
+
+    TEST_ASSERT_EQ(cb_detect_outliers(samples, 1024, outlier_flags,
+                                      &outlier_count),
+                   CB_OK, "detect_outliers should succeed");
+
+    /* Reference: recompute every flag with the division form */
+    memcpy(sorted, samples, sizeof(sorted));
+    cb_sort_u64(sorted, 1024);
+    median = cb_percentile(sorted, 1024, 50);
+    for (i = 0; i < 1024; i++) {
+        sorted[i] = (samples[i] >= median) ? samples[i] - median
+                                           : median - samples[i];
+    }
+    cb_sort_u64(sorted, 1024);
+    mad = cb_percentile(sorted, 1024, 50);
+    TEST_ASSERT_GT(mad, 0, "fixture must have MAD > 0");
+
+    for (i = 0; i < 1024; i++) {
+        deviation = (samples[i] >= median) ? samples[i] - median
+                                           : median - samples[i];
+        z_scaled = (6745 * deviation) / mad;
+        TEST_ASSERT_EQ(outlier_flags[i], z_scaled > 35000,
+                       "flag matches division form");
+        if (z_scaled > 35000) {
+            reference_count++;
+        }
+    }
+    TEST_ASSERT_EQ(outlier_count, reference_count, "count matches");
+    TEST_ASSERT_GE(outlier_count, 3, "planted outliers detected");
+
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Streaming Statistics (SRS-002-METRICS §4.6)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Streamed mean/min/max must match the batch computation exactly
+ */
+static int test_stream_matches_batch(void)
+{
+    static uint64_t samples[1000];
+    cb_stats_stream_t stream;
+    cb_latency_stats_t batch_stats, stream_stats;
+    cb_fault_flags_t faults;
+    uint32_t i;
+
+    for (i = 0; i < 1000; i++) {
+        samples[i] = 1000 + (uint64_t)((i * 7919) % 500);  /* Deterministic spread */
+    }
+
+    cb_stats_stream_init(&stream);
+    for (i = 0; i < 1000; i++) {
+        cb_stats_stream_update(&stream, samples[i]);
+    }
+    cb_fault_clear(&faults);
+    TEST_ASSERT_EQ(cb_stats_stream_final(&stream, &stream_stats, &faults), CB_OK,
+                   "stream finalise succeeds");
+
+    cb_fault_clear(&faults);
+    cb_compute_stats(samples, 1000, &batch_stats, &faults);
+
+    TEST_ASSERT_EQ(stream_stats.min_ns, batch_stats.min_ns, "streamed min exact");
+    TEST_ASSERT_EQ(stream_stats.max_ns, batch_stats.max_ns, "streamed max exact");
+    TEST_ASSERT_EQ(stream_stats.mean_ns, batch_stats.mean_ns, "streamed mean exact");
+    TEST_ASSERT_EQ(stream_stats.sample_count, 1000, "streamed count");
+
+    /* P² percentiles are estimates — allow 5% relative error on this input */
+    TEST_ASSERT_GE(stream_stats.median_ns, (batch_stats.median_ns * 95) / 100,
+                   "streamed median lower bound");
+    TEST_ASSERT_LE(stream_stats.median_ns, (batch_stats.median_ns * 105) / 100,
+                   "streamed median upper bound");
+    TEST_ASSERT_GE(stream_stats.p99_ns, (batch_stats.p99_ns * 95) / 100,
+                   "streamed p99 lower bound");
+    TEST_ASSERT_LE(stream_stats.p99_ns, (batch_stats.p99_ns * 105) / 100,
+                   "streamed p99 upper bound");
+    return 0;
+}
+
+/**
+ * @brief Accumulator must accept more than CB_MAX_SAMPLES observations
+ */
+static int test_stream_exceeds_max_samples(void)
+{
+    cb_stats_stream_t stream;
+    cb_latency_stats_t stats;
+    cb_fault_flags_t faults;
+    uint64_t i;
+    uint64_t total = (uint64_t)CB_MAX_SAMPLES + 500000;
+
+    cb_stats_stream_init(&stream);
+    for (i = 0; i < total; i++) {
+        cb_stats_stream_update(&stream, 2000 + (i % 100));
+    }
+    cb_fault_clear(&faults);
+    TEST_ASSERT_EQ(cb_stats_stream_final(&stream, &stats, &faults), CB_OK,
+                   "finalise beyond CB_MAX_SAMPLES");
+    TEST_ASSERT_EQ(stream.count, total, "full count retained");
+    TEST_ASSERT_EQ(stats.min_ns, 2000, "min over long stream");
+    TEST_ASSERT_EQ(stats.max_ns, 2099, "max over long stream");
+    TEST_ASSERT_GE(stats.mean_ns, 2040, "mean lower bound");
+    TEST_ASSERT_LE(stats.mean_ns, 2059, "mean upper bound");
+    return 0;
+}
+
+/**
+ * @brief Seeding phase (≤ 5 samples) must be exact
+ */
+static int test_stream_small_exact(void)
+{
+    cb_stats_stream_t stream;
+    cb_latency_stats_t stats;
+    cb_fault_flags_t faults;
+
+    cb_stats_stream_init(&stream);
+    cb_stats_stream_update(&stream, 30);
+    cb_stats_stream_update(&stream, 10);
+    cb_stats_stream_update(&stream, 20);
+    cb_fault_clear(&faults);
+    TEST_ASSERT_EQ(cb_stats_stream_final(&stream, &stats, &faults), CB_OK,
+                   "small stream finalise");
+    TEST_ASSERT_EQ(stats.median_ns, 20, "exact median while seeding");
+    TEST_ASSERT_EQ(stats.min_ns, 10, "min");
+    TEST_ASSERT_EQ(stats.max_ns, 30, "max");
+    TEST_ASSERT_EQ(stats.mean_ns, 20, "mean");
+    return 0;
+}
+
+static int test_stream_null_empty(void)
+{
+    cb_stats_stream_t stream;
+    cb_latency_stats_t stats;
+    cb_fault_flags_t faults;
+
+    TEST_ASSERT_EQ(cb_stats_stream_init(NULL), CB_ERR_NULL_PTR, "init NULL");
+    TEST_ASSERT_EQ(cb_stats_stream_update(NULL, 1), CB_ERR_NULL_PTR, "update NULL");
+
+    cb_stats_stream_init(&stream);
+    cb_fault_clear(&faults);
+    TEST_ASSERT_NE(cb_stats_stream_final(&stream, &stats, &faults), CB_OK,
+                   "finalise with no samples fails");
+    TEST_ASSERT(faults.div_zero, "div_zero fault on empty stream");
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Mergeable Statistics (CB-MATH-001 §6.8)
+ * Traceability: SRS-002-METRICS §4.7
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Test that merging partials matches stats over the whole array
+ * @satisfies METRICS-F-070
+ */
+static int test_stats_merge_matches_batch(void)
+{
+    /* Uniform values within each part keep per-part means exact, so
+     * the pooled result must equal the single-pass computation */
+    uint64_t combined[400];
+    uint64_t part1[100], part2[300];
+    cb_latency_stats_t s1, s2, whole, merged;
+    cb_latency_stats_t parts[2];
+    cb_fault_flags_t faults;
+    uint32_t i;
+
+    for (i = 0; i < 100; i++) part1[i] = 1000;
+    for (i = 0; i < 300; i++) part2[i] = 3000;
+    for (i = 0; i < 100; i++) combined[i] = 1000;
+    for (i = 100; i < 400; i++) combined[i] = 3000;
+
+    cb_fault_clear(&faults);
+    TEST_ASSERT_EQ(cb_compute_stats(part1, 100, &s1, &faults), CB_OK, "part 1");
+    TEST_ASSERT_EQ(cb_compute_stats(part2, 300, &s2, &faults), CB_OK, "part 2");
+    TEST_ASSERT_EQ(cb_compute_stats(combined, 400, &whole, &faults), CB_OK,
+                   "whole array");
+
+    parts[0] = s1;
+    parts[1] = s2;
+    cb_fault_clear(&faults);
+    TEST_ASSERT_EQ(cb_stats_merge(parts, 2, &merged, &faults), CB_OK, "merge");
+
+    TEST_ASSERT_EQ(merged.sample_count, whole.sample_count, "count matches");
+    TEST_ASSERT_EQ(merged.mean_ns, whole.mean_ns, "pooled mean exact");
+    TEST_ASSERT_EQ(merged.min_ns, whole.min_ns, "min matches");
+    TEST_ASSERT_EQ(merged.max_ns, whole.max_ns, "max matches");
+    /* Pooled S = 100·1500² + 300·500² = 3×10⁸; the closed form is
+     * exact while the single-pass integer Welford carries rounding,
+     * so compare against the formula and loosely against the batch */
+    TEST_ASSERT_EQ(merged.variance_ns2, 300000000ULL / 399,
+                   "pooled variance matches the closed form");
+    TEST_ASSERT_LT(merged.variance_ns2 > whole.variance_ns2
+                       ? merged.variance_ns2 - whole.variance_ns2
+                       : whole.variance_ns2 - merged.variance_ns2,
+                   whole.variance_ns2 / 10,
+                   "pooled variance near the single-pass value");
+    TEST_ASSERT_GE(merged.p99_ns, whole.p99_ns,
+                   "merged p99 is a conservative upper bound");
+
+    return 0;
+}
+
+/**
+ * @brief Test cb_stats_merge parameter validation
+ * @satisfies METRICS-F-070
+ */
+static int test_stats_merge_invalid(void)
+{
+    cb_latency_stats_t part, out;
+    cb_fault_flags_t faults;
+
+    memset(&part, 0, sizeof(part));
+    cb_fault_clear(&faults);
+
+    TEST_ASSERT_EQ(cb_stats_merge(NULL, 1, &out, &faults), CB_ERR_NULL_PTR,
+                   "NULL parts");
+    TEST_ASSERT_EQ(cb_stats_merge(&part, 1, NULL, &faults), CB_ERR_NULL_PTR,
+                   "NULL out");
+    TEST_ASSERT_EQ(cb_stats_merge(&part, 0, &out, &faults),
+                   CB_ERR_INVALID_CONFIG, "zero parts");
+
+    /* Parts holding no samples mirror the empty-stream behaviour */
+    TEST_ASSERT_EQ(cb_stats_merge(&part, 1, &out, &faults), CB_ERR_OVERFLOW,
+                   "empty parts fail");
+    TEST_ASSERT(faults.div_zero, "div_zero fault on empty merge");
+
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Test: Determinism (SRS-002-METRICS §5.1)
  * Traceability: METRICS-NF-001
@@ -751,6 +1318,9 @@ int main(void)
     RUN_TEST(test_sort_reverse);
     RUN_TEST(test_sort_duplicates);
     RUN_TEST(test_sort_large);
+    RUN_TEST(test_sort_radix_matches);
+    RUN_TEST(test_sort_radix_auto_path);
+    RUN_TEST(test_sort_radix_edge);
 
     printf("\n§4.3 Percentile Computation (METRICS-F-030..036)\n");
     RUN_TEST(test_percentile_vectors);
@@ -758,6 +1328,9 @@ int main(void)
     RUN_TEST(test_percentile_single);
     RUN_TEST(test_percentile_two);
     RUN_TEST(test_percentile_null);
+    RUN_TEST(test_percentile_select_matches);
+    RUN_TEST(test_percentile_select3);
+    RUN_TEST(test_percentile_select_invalid);
 
     printf("\n§4.1 Basic Statistics (METRICS-F-001..010)\n");
     RUN_TEST(test_stats_basic);
@@ -774,6 +1347,10 @@ int main(void)
     RUN_TEST(test_histogram_overflow);
     RUN_TEST(test_histogram_null);
     RUN_TEST(test_histogram_invalid);
+    RUN_TEST(test_histogram_log_layout);
+    RUN_TEST(test_histogram_log_binning);
+    RUN_TEST(test_histogram_log_invalid);
+    RUN_TEST(test_histogram_reciprocal_exact);
 
     printf("\n§4.5 Outlier Detection (METRICS-F-050..056)\n");
     RUN_TEST(test_outliers_vectors);
@@ -781,6 +1358,17 @@ int main(void)
     RUN_TEST(test_outliers_mad_zero);
     RUN_TEST(test_outliers_null);
     RUN_TEST(test_outliers_empty);
+    RUN_TEST(test_outliers_cutoff_equivalence);
+
+    printf("\n§4.6 Streaming Statistics\n");
+    RUN_TEST(test_stream_matches_batch);
+    RUN_TEST(test_stream_exceeds_max_samples);
+    RUN_TEST(test_stream_small_exact);
+    RUN_TEST(test_stream_null_empty);
+
+    printf("\n§4.7 Mergeable Statistics (CB-MATH-001 §6.8)\n");
+    RUN_TEST(test_stats_merge_matches_batch);
+    RUN_TEST(test_stats_merge_invalid);
 
     printf("\n§5.1 Determinism (METRICS-NF-001)\n");
     RUN_TEST(test_determinism);
@@ -11,12 +11,15 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#define _POSIX_C_SOURCE 199309L  /* nanosleep */
+
 #include "cb_platform.h"
 #include "cb_timer.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 /*─────────────────────────────────────────────────────────────────────────────
  * Test Infrastructure
@@ -247,6 +250,74 @@ static int test_hwcounters_stop_null(void)
     return 0;
 }
 
+/**
+ * @brief Test running-counter snapshot reads
+ * @satisfies PLATFORM-F-022, PLATFORM-F-023
+ */
+static int test_hwcounters_read_running(void)
+{
+    cb_hwcounters_t first, second, final;
+    cb_result_code_t rc;
+
+    if (!cb_hwcounters_available()) {
+        printf("    (skipped - counters unavailable)\n");
+        return 0;
+    }
+
+    rc = cb_hwcounters_start();
+    TEST_ASSERT_EQ(rc, CB_OK, "hwcounters_start should succeed");
+
+    volatile int sum = 0;
+    for (int i = 0; i < 50000; i++) {
+        sum += i;
+    }
+
+    rc = cb_hwcounters_read(&first);
+    TEST_ASSERT_EQ(rc, CB_OK, "read while running should succeed");
+    TEST_ASSERT_GT(first.cycles, 0, "first snapshot should have cycles");
+
+    for (int i = 0; i < 50000; i++) {
+        sum += i;
+    }
+    (void)sum;
+
+    rc = cb_hwcounters_read(&second);
+    TEST_ASSERT_EQ(rc, CB_OK, "second read should succeed");
+    TEST_ASSERT_GT(second.cycles, first.cycles,
+                   "cumulative cycles should grow between snapshots");
+
+    /* Stop must still work after intermediate reads */
+    rc = cb_hwcounters_stop(&final);
+    TEST_ASSERT_EQ(rc, CB_OK, "stop after reads should succeed");
+    TEST_ASSERT_GE(final.cycles, second.cycles,
+                   "final count should include all snapshots");
+
+    printf("    Fast path: %s\n",
+           cb_hwcounters_fast_available() ? "mmap/RDPMC" : "syscall");
+
+    return 0;
+}
+
+/**
+ * @brief Test cb_hwcounters_read error handling
+ * @satisfies PLATFORM-F-022, PLATFORM-F-027
+ */
+static int test_hwcounters_read_errors(void)
+{
+    cb_hwcounters_t counters;
+    cb_result_code_t rc;
+
+    rc = cb_hwcounters_read(NULL);
+    TEST_ASSERT_EQ(rc, CB_ERR_NULL_PTR, "NULL counters should return error");
+
+    /* Not started — read must fail cleanly */
+    rc = cb_hwcounters_read(&counters);
+    TEST_ASSERT_EQ(rc, CB_ERR_HWCOUNTERS, "read before start should fail");
+    TEST_ASSERT_EQ(counters.available, false, "should report unavailable");
+
+    return 0;
+}
+
 /**
  * @brief Test counter access failure doesn't crash
  * @satisfies PLATFORM-F-027
@@ -372,6 +443,124 @@ static int test_env_compute_stats_null(void)
     return 0;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Persistent Environmental Monitor (SRS-006-PLATFORM §4.7)
+ * Traceability: PLATFORM-F-070 through PLATFORM-F-076
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Test monitor init/start/stop lifecycle and over-run stats
+ * @satisfies PLATFORM-F-070 through PLATFORM-F-075
+ */
+static int test_env_monitor_lifecycle(void)
+{
+    cb_env_snapshot_t ring[16];
+    cb_env_monitor_t monitor;
+    cb_env_stats_t stats;
+    cb_result_code_t rc;
+    struct timespec delay = {0, 20 * 1000000L};  /* 20 ms */
+
+    rc = cb_env_monitor_init(&monitor, ring, 16, 1);
+    TEST_ASSERT_EQ(rc, CB_OK, "monitor init should succeed");
+    TEST_ASSERT_EQ(monitor.sample_count, 1, "init takes an immediate sample");
+
+    rc = cb_env_monitor_start(&monitor);
+    TEST_ASSERT_EQ(rc, CB_OK, "monitor start should succeed");
+
+    nanosleep(&delay, NULL);
+
+    rc = cb_env_monitor_stop(&monitor, &stats);
+    TEST_ASSERT_EQ(rc, CB_OK, "monitor stop should succeed");
+
+    /* Init sample + final sample + background samples over 20 ms */
+    TEST_ASSERT_GE(monitor.sample_count, 3,
+                   "background thread should have sampled");
+    TEST_ASSERT_GE(stats.end.timestamp_ns, stats.start.timestamp_ns,
+                   "end should not precede start");
+    TEST_ASSERT_LE(stats.min_freq_hz, stats.max_freq_hz, "min <= max freq");
+    TEST_ASSERT_LE(stats.min_temp_mC, stats.max_temp_mC, "min <= max temp");
+
+    printf("    Samples: %u, freq range: [%lu, %lu] Hz\n",
+           monitor.sample_count,
+           (unsigned long)stats.min_freq_hz,
+           (unsigned long)stats.max_freq_hz);
+
+    return 0;
+}
+
+/**
+ * @brief Test monitor extrema survive ring wrap-around
+ * @satisfies PLATFORM-F-074
+ */
+static int test_env_monitor_ring_wrap(void)
+{
+    cb_env_snapshot_t ring[2];
+    cb_env_monitor_t monitor;
+    cb_env_stats_t stats;
+    cb_result_code_t rc;
+    struct timespec delay = {0, 20 * 1000000L};  /* 20 ms */
+
+    rc = cb_env_monitor_init(&monitor, ring, 2, 1);
+    TEST_ASSERT_EQ(rc, CB_OK, "monitor init should succeed");
+
+    rc = cb_env_monitor_start(&monitor);
+    TEST_ASSERT_EQ(rc, CB_OK, "monitor start should succeed");
+
+    nanosleep(&delay, NULL);
+
+    rc = cb_env_monitor_stop(&monitor, &stats);
+    TEST_ASSERT_EQ(rc, CB_OK, "monitor stop should succeed");
+
+    /* More samples than slots — first snapshot must survive the wrap */
+    TEST_ASSERT_GT(monitor.sample_count, 2, "ring should have wrapped");
+    TEST_ASSERT_EQ(stats.start.timestamp_ns, monitor.first.timestamp_ns,
+                   "start snapshot should predate the wrap");
+    TEST_ASSERT_GE(stats.end.timestamp_ns, stats.start.timestamp_ns,
+                   "end should not precede start");
+
+    return 0;
+}
+
+/**
+ * @brief Test monitor parameter validation
+ * @satisfies PLATFORM-F-070, PLATFORM-F-072, PLATFORM-F-073
+ */
+static int test_env_monitor_invalid(void)
+{
+    cb_env_snapshot_t ring[4];
+    cb_env_monitor_t monitor;
+    cb_result_code_t rc;
+
+    rc = cb_env_monitor_init(NULL, ring, 4, 10);
+    TEST_ASSERT_EQ(rc, CB_ERR_NULL_PTR, "NULL monitor should return error");
+
+    rc = cb_env_monitor_init(&monitor, NULL, 4, 10);
+    TEST_ASSERT_EQ(rc, CB_ERR_NULL_PTR, "NULL ring should return error");
+
+    rc = cb_env_monitor_init(&monitor, ring, 0, 10);
+    TEST_ASSERT_EQ(rc, CB_ERR_INVALID_CONFIG, "zero capacity should fail");
+
+    rc = cb_env_monitor_init(&monitor, ring, 4, 0);
+    TEST_ASSERT_EQ(rc, CB_ERR_INVALID_CONFIG, "zero period should fail");
+
+    rc = cb_env_monitor_start(NULL);
+    TEST_ASSERT_EQ(rc, CB_ERR_NULL_PTR, "NULL start should return error");
+
+    rc = cb_env_monitor_stop(NULL, NULL);
+    TEST_ASSERT_EQ(rc, CB_ERR_NULL_PTR, "NULL stop should return error");
+
+    /* Stop after stop requires re-initialisation */
+    rc = cb_env_monitor_init(&monitor, ring, 4, 10);
+    TEST_ASSERT_EQ(rc, CB_OK, "monitor init should succeed");
+    rc = cb_env_monitor_stop(&monitor, NULL);
+    TEST_ASSERT_EQ(rc, CB_OK, "stop without start collapses to snapshots");
+    rc = cb_env_monitor_stop(&monitor, NULL);
+    TEST_ASSERT_EQ(rc, CB_ERR_INVALID_CONFIG,
+                   "second stop should require re-init");
+
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Test: Stability Assessment (SRS-006-PLATFORM §4.9)
  * Traceability: PLATFORM-F-090 through PLATFORM-F-094
@@ -489,6 +678,60 @@ static int test_graceful_failure(void)
     return 0;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Cache Control (SRS-006-PLATFORM §4.8)
+ * Traceability: PLATFORM-F-080..082
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+static uint8_t g_flush_buffer[65536];
+
+/**
+ * @brief Test cache flush over a buffer
+ * @satisfies PLATFORM-F-080
+ */
+static int test_cache_flush_range(void)
+{
+    uint32_t i;
+    uint64_t sum = 0;
+
+    /* Populate so the lines are resident and dirty */
+    for (i = 0; i < sizeof(g_flush_buffer); i++) {
+        g_flush_buffer[i] = (uint8_t)(i * 7U);
+    }
+
+    TEST_ASSERT_EQ(cb_cache_flush_range(g_flush_buffer,
+                                        sizeof(g_flush_buffer)),
+                   CB_OK, "flush should succeed");
+
+    /* Contents must be unchanged — flush evicts, never corrupts */
+    for (i = 0; i < sizeof(g_flush_buffer); i++) {
+        sum += g_flush_buffer[i] ^ (uint8_t)(i * 7U);
+    }
+    TEST_ASSERT_EQ(sum, 0, "flush should not alter memory");
+
+    /* Unaligned sub-range is legal */
+    TEST_ASSERT_EQ(cb_cache_flush_range(g_flush_buffer + 3, 100),
+                   CB_OK, "unaligned range should succeed");
+
+    return 0;
+}
+
+/**
+ * @brief Test cache flush argument handling
+ * @satisfies PLATFORM-F-081
+ */
+static int test_cache_flush_invalid(void)
+{
+    TEST_ASSERT_EQ(cb_cache_flush_range(NULL, 64), CB_ERR_NULL_PTR,
+                   "NULL with size should fail");
+    TEST_ASSERT_EQ(cb_cache_flush_range(NULL, 0), CB_OK,
+                   "empty range is a no-op");
+    TEST_ASSERT_EQ(cb_cache_flush_range(g_flush_buffer, 0), CB_OK,
+                   "zero size is a no-op");
+
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Test: Performance (SRS-006-PLATFORM §5.1)
  * Traceability: PLATFORM-NF-001, PLATFORM-NF-003
@@ -554,6 +797,8 @@ int main(void)
     RUN_TEST(test_hwcounters_available);
     RUN_TEST(test_hwcounters_cycle);
     RUN_TEST(test_hwcounters_stop_null);
+    RUN_TEST(test_hwcounters_read_running);
+    RUN_TEST(test_hwcounters_read_errors);
     RUN_TEST(test_hwcounters_graceful);
 
     printf("\n§4.6 Environmental Monitoring (PLATFORM-F-060..068)\n");
@@ -562,6 +807,15 @@ int main(void)
     RUN_TEST(test_env_compute_stats);
     RUN_TEST(test_env_compute_stats_null);
 
+    printf("\n§4.7 Persistent Monitor (PLATFORM-F-070..076)\n");
+    RUN_TEST(test_env_monitor_lifecycle);
+    RUN_TEST(test_env_monitor_ring_wrap);
+    RUN_TEST(test_env_monitor_invalid);
+
+    printf("\n§4.8 Cache Control (PLATFORM-F-080..082)\n");
+    RUN_TEST(test_cache_flush_range);
+    RUN_TEST(test_cache_flush_invalid);
+
     printf("\n§4.9 Stability Assessment (PLATFORM-F-090..094)\n");
     RUN_TEST(test_env_stable);
     RUN_TEST(test_env_unstable);
@@ -12,6 +12,7 @@
  */
 
 #include "cb_report.h"
+#include "cb_metrics.h"
 #include "cb_verify.h"
 
 #include <stdio.h>
@@ -102,6 +103,15 @@ static void create_test_result(cb_result_t *result)
     result->environment.max_temp_mC = 55000;
     result->environment.total_throttle_events = 0;
 
+    result->overhead.warmup_ns = 200000000ULL;
+    result->overhead.timed_ns = 1600000000ULL;
+    result->overhead.verify_ns = 120000000ULL;
+    result->overhead.stats_ns = 30000000ULL;
+    result->overhead.total_ns = 2200000000ULL;
+
+    /* Forensics: three tail samples captured, ring not attached */
+    result->forensic_captured = 3;
+
     result->benchmark_start_ns = 1000000000000ULL;
     result->benchmark_end_ns = 1002000000000ULL;
     result->benchmark_duration_ns = 2000000000ULL;
@@ -357,6 +367,66 @@ static int test_write_json_io_error(void)
     return 0;
 }
 
+/**
+ * @brief Test buffered writer produces the same bytes as the file path
+ * @satisfies REPORT-NF-004
+ */
+static int test_write_json_buf_matches_file(void)
+{
+    static char buffer[CB_JSON_MAX_SIZE];
+    static char file_copy[CB_JSON_MAX_SIZE];
+    cb_result_t result;
+    size_t length, file_len;
+    FILE *fp;
+    const char *path = "/tmp/cb_test_result.json";
+
+    create_test_result(&result);
+
+    TEST_ASSERT_EQ(cb_write_json_buf(&result, buffer, sizeof(buffer), &length),
+                   CB_OK, "buffered write should succeed");
+    TEST_ASSERT(length > 0, "document is non-empty");
+
+    cb_write_json(&result, path);
+    fp = fopen(path, "r");
+    TEST_ASSERT(fp != NULL, "file written");
+    file_len = fread(file_copy, 1, sizeof(file_copy), fp);
+    fclose(fp);
+    unlink(path);
+
+    TEST_ASSERT_EQ(length, file_len, "buffer and file lengths agree");
+    TEST_ASSERT(memcmp(buffer, file_copy, length) == 0,
+                "buffer and file contents identical");
+
+    return 0;
+}
+
+/**
+ * @brief Test buffered writer rejects undersized buffers and NULLs
+ * @satisfies REPORT-NF-004
+ */
+static int test_write_json_buf_invalid(void)
+{
+    static char buffer[CB_JSON_MAX_SIZE];
+    char tiny[64];
+    cb_result_t result;
+    size_t length;
+
+    create_test_result(&result);
+
+    TEST_ASSERT_EQ(cb_write_json_buf(&result, tiny, sizeof(tiny), &length),
+                   CB_ERR_OUT_OF_MEMORY, "undersized buffer rejected");
+    TEST_ASSERT_EQ(length, 0, "truncated document reports zero length");
+
+    TEST_ASSERT_EQ(cb_write_json_buf(NULL, buffer, sizeof(buffer), &length),
+                   CB_ERR_NULL_PTR, "NULL result rejected");
+    TEST_ASSERT_EQ(cb_write_json_buf(&result, NULL, 0, &length),
+                   CB_ERR_NULL_PTR, "NULL buffer rejected");
+    TEST_ASSERT_EQ(cb_write_json_buf(&result, buffer, sizeof(buffer), NULL),
+                   CB_ERR_NULL_PTR, "NULL length rejected");
+
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Test: CSV Output (REPORT-F-020..026)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -442,6 +512,92 @@ static int test_write_csv_null(void)
     return 0;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Sharded CSV (REPORT-F-027..029)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Count lines in a file
+ */
+static int count_lines(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    int lines = 0;
+    int c;
+
+    if (!fp) return -1;
+    while ((c = fgetc(fp)) != EOF) {
+        if (c == '\n') lines++;
+    }
+    fclose(fp);
+    return lines;
+}
+
+/**
+ * @brief Test shard append and merge into the canonical CSV
+ * @satisfies REPORT-F-027, REPORT-F-028, REPORT-F-029
+ */
+static int test_csv_shard_merge(void)
+{
+    cb_result_t result;
+    const char *base = "/tmp/cb_test_fleet.csv";
+    const char *merged = "/tmp/cb_test_fleet_merged.csv";
+    cb_result_code_t rc;
+
+    create_test_result(&result);
+
+    /* Two rows from this process's shard, one from a simulated
+     * sibling process (shards are plain row files) */
+    TEST_ASSERT_EQ(cb_append_csv_shard(&result, base), CB_OK,
+                   "first shard append");
+    TEST_ASSERT_EQ(cb_append_csv_shard(&result, base), CB_OK,
+                   "second shard append");
+    TEST_ASSERT_EQ(cb_append_csv(&result,
+                                 "/tmp/cb_test_fleet.csv.shard.99999.csv"),
+                   CB_OK, "sibling shard append");
+
+    rc = cb_csv_merge(base, merged, true);
+    TEST_ASSERT_EQ(rc, CB_OK, "merge should succeed");
+
+    /* Header plus three rows */
+    TEST_ASSERT_EQ(count_lines(merged), 4, "merged CSV has header + 3 rows");
+    TEST_ASSERT(file_contains(merged, "min_ns"), "header present");
+    TEST_ASSERT(file_contains(merged, "Test CPU"), "rows present");
+
+    /* Compaction consumed the shards: a second merge yields header only */
+    rc = cb_csv_merge(base, merged, false);
+    TEST_ASSERT_EQ(rc, CB_OK, "merge of empty shard set succeeds");
+    TEST_ASSERT_EQ(count_lines(merged), 1, "shards were removed");
+
+    unlink(merged);
+    return 0;
+}
+
+/**
+ * @brief Test sharded CSV argument handling
+ * @satisfies REPORT-F-028, REPORT-F-029
+ */
+static int test_csv_shard_invalid(void)
+{
+    cb_result_t result;
+
+    create_test_result(&result);
+
+    TEST_ASSERT_EQ(cb_append_csv_shard(NULL, "/tmp/x.csv"), CB_ERR_NULL_PTR,
+                   "NULL result should fail");
+    TEST_ASSERT_EQ(cb_append_csv_shard(&result, NULL), CB_ERR_NULL_PTR,
+                   "NULL base should fail");
+    TEST_ASSERT_EQ(cb_csv_merge(NULL, "/tmp/x.csv", false), CB_ERR_NULL_PTR,
+                   "NULL base should fail");
+    TEST_ASSERT_EQ(cb_csv_merge("/tmp/x.csv", NULL, false), CB_ERR_NULL_PTR,
+                   "NULL out_path should fail");
+    TEST_ASSERT_EQ(cb_csv_merge("/nonexistent/dir/x.csv", "/tmp/x.csv",
+                                false),
+                   CB_ERR_IO, "missing shard directory should fail");
+
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Test: JSON Loading (REPORT-F-030..035)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -470,6 +626,14 @@ static int test_json_roundtrip(void)
                    original.throughput.inferences_per_sec, "throughput should match");
     TEST_ASSERT_EQ(loaded.timestamp_unix, original.timestamp_unix, "timestamp should match");
     TEST_ASSERT(cb_hash_equal(&loaded.output_hash, &original.output_hash), "hash should match");
+    TEST_ASSERT_EQ(loaded.overhead.timed_ns, original.overhead.timed_ns,
+                   "overhead timed_ns should match");
+    TEST_ASSERT_EQ(loaded.overhead.total_ns, original.overhead.total_ns,
+                   "overhead total_ns should match");
+    TEST_ASSERT_EQ(loaded.forensic_captured, original.forensic_captured,
+                   "forensic capture count should match");
+    TEST_ASSERT(loaded.forensic_ring == NULL,
+                "ring pointer never reconstructed from a file");
 
     unlink(path);
     return 0;
@@ -507,6 +671,106 @@ static int test_load_json_null(void)
     return 0;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Binary Result Format (SRS-005-REPORT §4.6)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Test binary write/load roundtrip preserves every field
+ */
+static int test_binary_roundtrip(void)
+{
+    cb_result_t original, loaded;
+    cb_result_code_t rc;
+    const char *path = "/tmp/cb_test_roundtrip.cbr";
+
+    create_test_result(&original);
+    rc = cb_write_binary(&original, path);
+    TEST_ASSERT_EQ(rc, CB_OK, "write_binary should succeed");
+
+    rc = cb_load_binary(path, &loaded);
+    TEST_ASSERT_EQ(rc, CB_OK, "load_binary should succeed");
+
+    /* Binary roundtrip is lossless — full structural comparison except
+     * the histogram pointer, which is intentionally stripped */
+    TEST_ASSERT_STR_EQ(loaded.platform, original.platform, "platform should match");
+    TEST_ASSERT_EQ(loaded.latency.min_ns, original.latency.min_ns, "min_ns should match");
+    TEST_ASSERT_EQ(loaded.latency.variance_ns2, original.latency.variance_ns2,
+                   "variance should match");
+    TEST_ASSERT_EQ(loaded.latency.wcet_bound_ns, original.latency.wcet_bound_ns,
+                   "wcet bound should match");
+    TEST_ASSERT_EQ(loaded.throughput.bytes_per_sec, original.throughput.bytes_per_sec,
+                   "bytes_per_sec should match");
+    TEST_ASSERT_EQ(loaded.environment.max_temp_mC, original.environment.max_temp_mC,
+                   "environment should match");
+    TEST_ASSERT_EQ(loaded.timestamp_unix, original.timestamp_unix, "timestamp should match");
+    TEST_ASSERT(cb_hash_equal(&loaded.output_hash, &original.output_hash),
+                "output hash should match");
+    TEST_ASSERT(cb_hash_equal(&loaded.result_hash, &original.result_hash),
+                "result hash should match");
+    TEST_ASSERT(loaded.histogram.bins == NULL, "histogram pointer stripped");
+
+    unlink(path);
+    return 0;
+}
+
+/**
+ * @brief Test corrupted payload is rejected by checksum
+ */
+static int test_binary_detects_corruption(void)
+{
+    cb_result_t original, loaded;
+    cb_result_code_t rc;
+    const char *path = "/tmp/cb_test_corrupt.cbr";
+    FILE *fp;
+    uint8_t byte;
+
+    create_test_result(&original);
+    cb_write_binary(&original, path);
+
+    /* Flip one payload byte past the header */
+    fp = fopen(path, "r+b");
+    TEST_ASSERT(fp != NULL, "reopen for corruption");
+    fseek(fp, (long)(sizeof(cb_binary_header_t) + 40), SEEK_SET);
+    byte = (uint8_t)fgetc(fp);
+    fseek(fp, (long)(sizeof(cb_binary_header_t) + 40), SEEK_SET);
+    fputc(byte ^ 0xFF, fp);
+    fclose(fp);
+
+    rc = cb_load_binary(path, &loaded);
+    TEST_ASSERT_EQ(rc, CB_ERR_INVALID_CONFIG, "corrupt payload rejected");
+
+    unlink(path);
+    return 0;
+}
+
+/**
+ * @brief Test bad magic and truncated files are rejected
+ */
+static int test_binary_rejects_invalid(void)
+{
+    cb_result_t loaded;
+    const char *path = "/tmp/cb_test_badmagic.cbr";
+    FILE *fp;
+
+    /* Not a .cbr file at all */
+    fp = fopen(path, "wb");
+    TEST_ASSERT(fp != NULL, "create bad file");
+    fputs("{\"version\": 1}", fp);
+    fclose(fp);
+    TEST_ASSERT_EQ(cb_load_binary(path, &loaded), CB_ERR_IO,
+                   "truncated header rejected");
+    unlink(path);
+
+    TEST_ASSERT_EQ(cb_load_binary("/nonexistent/path/result.cbr", &loaded),
+                   CB_ERR_IO, "missing file should return IO error");
+
+    TEST_ASSERT_EQ(cb_write_binary(NULL, path), CB_ERR_NULL_PTR, "NULL result fails");
+    TEST_ASSERT_EQ(cb_load_binary(NULL, &loaded), CB_ERR_NULL_PTR, "NULL path fails");
+    TEST_ASSERT_EQ(cb_load_binary(path, NULL), CB_ERR_NULL_PTR, "NULL output fails");
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Test: Comparison (REPORT-F-040..049)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -680,6 +944,150 @@ static int test_compare_null(void)
     return 0;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Fleet Result Merging (REPORT-F-070..078)
+ * Traceability: SRS-005-REPORT §4.8, CB-MATH-001 §6.8
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Test pooled latency merge and fleet throughput sum
+ * @satisfies REPORT-F-070 through REPORT-F-075
+ */
+static int test_merge_pooled_stats(void)
+{
+    cb_result_t partials[2];
+    cb_result_t merged;
+    cb_result_code_t rc;
+
+    create_test_result(&partials[0]);
+    create_test_result(&partials[1]);
+
+    /* Uniform per-node samples make the pooled mean exact by hand:
+     * (1000·100 + 3000·300) / 400 = 2500 */
+    partials[0].latency.mean_ns = 1000;
+    partials[0].latency.min_ns = 800;
+    partials[0].latency.max_ns = 1200;
+    partials[0].latency.p99_ns = 1150;
+    partials[0].latency.variance_ns2 = 0;
+    partials[0].latency.stddev_ns = 0;
+    partials[0].latency.sample_count = 100;
+
+    partials[1].latency.mean_ns = 3000;
+    partials[1].latency.min_ns = 2500;
+    partials[1].latency.max_ns = 3600;
+    partials[1].latency.p99_ns = 3500;
+    partials[1].latency.variance_ns2 = 0;
+    partials[1].latency.stddev_ns = 0;
+    partials[1].latency.sample_count = 300;
+
+    rc = cb_result_merge(partials, 2, &merged, NULL, 0);
+    TEST_ASSERT_EQ(rc, CB_OK, "merge should succeed");
+
+    TEST_ASSERT_EQ(merged.latency.sample_count, 400, "counts should sum");
+    TEST_ASSERT_EQ(merged.latency.mean_ns, 2500, "pooled mean should be exact");
+    TEST_ASSERT_EQ(merged.latency.min_ns, 800, "fleet min");
+    TEST_ASSERT_EQ(merged.latency.max_ns, 3600, "fleet max");
+    TEST_ASSERT_EQ(merged.latency.p99_ns, 3500,
+                   "p99 should be the conservative maximum");
+
+    /* Pooled S = 100·1500² + 300·500² = 3×10⁸; variance = S / 399 */
+    TEST_ASSERT_EQ(merged.latency.variance_ns2, 300000000ULL / 399,
+                   "pooled variance should be exact");
+
+    TEST_ASSERT_EQ(merged.throughput.inferences_per_sec, 1000,
+                   "fleet throughput should sum");
+    TEST_ASSERT(merged.determinism_verified, "all nodes verified");
+    TEST_ASSERT_EQ(merged.histogram_valid, false,
+                   "no bins buffer means no merged histogram");
+
+    return 0;
+}
+
+/**
+ * @brief Test bin-wise histogram merge with identical binning
+ * @satisfies REPORT-F-076, REPORT-F-077
+ */
+static int test_merge_histogram(void)
+{
+    cb_result_t partials[2];
+    cb_result_t merged;
+    cb_histogram_bin_t bins_a[8], bins_b[8], bins_out[8];
+    cb_result_code_t rc;
+    uint32_t b;
+
+    create_test_result(&partials[0]);
+    create_test_result(&partials[1]);
+
+    rc = cb_histogram_init(&partials[0].histogram, bins_a, 8, 0, 800);
+    TEST_ASSERT_EQ(rc, CB_OK, "histogram init should succeed");
+    rc = cb_histogram_init(&partials[1].histogram, bins_b, 8, 0, 800);
+    TEST_ASSERT_EQ(rc, CB_OK, "histogram init should succeed");
+
+    for (b = 0; b < 8; b++) {
+        bins_a[b].count = b + 1;
+        bins_b[b].count = 10 * (b + 1);
+    }
+    partials[0].histogram.overflow_count = 2;
+    partials[1].histogram.underflow_count = 3;
+    partials[0].histogram_valid = true;
+    partials[1].histogram_valid = true;
+
+    rc = cb_result_merge(partials, 2, &merged, bins_out, 8);
+    TEST_ASSERT_EQ(rc, CB_OK, "merge should succeed");
+
+    TEST_ASSERT(merged.histogram_valid, "identical binning should merge");
+    for (b = 0; b < 8; b++) {
+        TEST_ASSERT_EQ(bins_out[b].count, 11 * (b + 1),
+                       "bin counts should sum");
+        TEST_ASSERT_EQ(bins_out[b].min_ns, bins_a[b].min_ns,
+                       "bin bounds should be preserved");
+    }
+    TEST_ASSERT_EQ(merged.histogram.overflow_count, 2, "overflow should sum");
+    TEST_ASSERT_EQ(merged.histogram.underflow_count, 3, "underflow should sum");
+
+    /* Mismatched binning must refuse rather than sum incompatible bins */
+    rc = cb_histogram_init(&partials[1].histogram, bins_b, 8, 0, 1600);
+    TEST_ASSERT_EQ(rc, CB_OK, "histogram re-init should succeed");
+    partials[1].histogram_valid = true;
+
+    rc = cb_result_merge(partials, 2, &merged, bins_out, 8);
+    TEST_ASSERT_EQ(rc, CB_OK, "merge should still succeed");
+    TEST_ASSERT_EQ(merged.histogram_valid, false,
+                   "mismatched binning should not produce a histogram");
+
+    return 0;
+}
+
+/**
+ * @brief Test cb_result_merge parameter validation
+ * @satisfies REPORT-F-070
+ */
+static int test_merge_invalid(void)
+{
+    cb_result_t partial;
+    cb_result_t merged;
+    cb_result_code_t rc;
+
+    create_test_result(&partial);
+
+    rc = cb_result_merge(NULL, 1, &merged, NULL, 0);
+    TEST_ASSERT_EQ(rc, CB_ERR_NULL_PTR, "NULL partials should return error");
+
+    rc = cb_result_merge(&partial, 1, NULL, NULL, 0);
+    TEST_ASSERT_EQ(rc, CB_ERR_NULL_PTR, "NULL merged should return error");
+
+    rc = cb_result_merge(&partial, 0, &merged, NULL, 0);
+    TEST_ASSERT_EQ(rc, CB_ERR_INVALID_CONFIG, "zero partials should fail");
+
+    /* Single partial is a valid degenerate merge */
+    rc = cb_result_merge(&partial, 1, &merged, NULL, 0);
+    TEST_ASSERT_EQ(rc, CB_OK, "single partial should merge");
+    TEST_ASSERT_EQ(merged.latency.mean_ns, partial.latency.mean_ns,
+                   "single merge should preserve the mean");
+
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Test: Human-Readable Output (REPORT-F-050..058)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -802,6 +1210,8 @@ int main(void)
     RUN_TEST(test_json_has_timestamp);
     RUN_TEST(test_write_json_null);
     RUN_TEST(test_write_json_io_error);
+    RUN_TEST(test_write_json_buf_matches_file);
+    RUN_TEST(test_write_json_buf_invalid);
 
     printf("\n§4.2 CSV Output (REPORT-F-020..026)\n");
     RUN_TEST(test_write_csv_creates_file);
@@ -809,11 +1219,20 @@ int main(void)
     RUN_TEST(test_csv_columns);
     RUN_TEST(test_write_csv_null);
 
+    printf("\n§4.9 Sharded CSV (REPORT-F-027..029)\n");
+    RUN_TEST(test_csv_shard_merge);
+    RUN_TEST(test_csv_shard_invalid);
+
     printf("\n§4.3 JSON Loading (REPORT-F-030..035)\n");
     RUN_TEST(test_json_roundtrip);
     RUN_TEST(test_load_json_missing_file);
     RUN_TEST(test_load_json_null);
 
+    printf("\n§4.6 Binary Result Format\n");
+    RUN_TEST(test_binary_roundtrip);
+    RUN_TEST(test_binary_detects_corruption);
+    RUN_TEST(test_binary_rejects_invalid);
+
     printf("\n§4.4 Comparison (REPORT-F-040..049)\n");
     RUN_TEST(test_compare_identical);
     RUN_TEST(test_compare_different_outputs);
@@ -823,6 +1242,11 @@ int main(void)
     RUN_TEST(test_compare_div_zero);
     RUN_TEST(test_compare_null);
 
+    printf("\n§4.8 Fleet Result Merging (REPORT-F-070..078)\n");
+    RUN_TEST(test_merge_pooled_stats);
+    RUN_TEST(test_merge_histogram);
+    RUN_TEST(test_merge_invalid);
+
     printf("\n§4.5 Human-Readable Output (REPORT-F-050..058)\n");
     RUN_TEST(test_print_summary_no_crash);
     RUN_TEST(test_print_comparison_no_crash);
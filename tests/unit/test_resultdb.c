@@ -0,0 +1,358 @@
+/**
+ * @file test_resultdb.c
+ * @brief Unit tests for cb_resultdb API
+ *
+ * Tests database lifecycle, sorted insertion, range queries, and
+ * latest-N lookups against all SRS-008-RESULTDB requirements.
+ *
+ * @traceability SRS-008-RESULTDB §10
+ *
+ * Copyright © 2026 The Murray Family Innovation Trust. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "cb_resultdb.h"
+#include "cb_verify.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test Infrastructure
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+static int g_tests_run = 0;
+static int g_tests_passed = 0;
+static int g_tests_failed = 0;
+
+#define TEST_ASSERT(cond, msg) do { \
+    g_tests_run++; \
+    if (!(cond)) { \
+        printf("    FAIL: %s\n", msg); \
+        printf("          at %s:%d\n", __FILE__, __LINE__); \
+        g_tests_failed++; \
+        return -1; \
+    } else { \
+        g_tests_passed++; \
+    } \
+} while(0)
+
+#define TEST_ASSERT_EQ(a, b, msg) TEST_ASSERT((a) == (b), msg)
+#define TEST_ASSERT_NE(a, b, msg) TEST_ASSERT((a) != (b), msg)
+
+#define RUN_TEST(fn) do { \
+    printf("  %s\n", #fn); \
+    int result = fn(); \
+    if (result == 0) { \
+        printf("    PASS\n"); \
+    } \
+} while(0)
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Fixture
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+static const char *g_data_path = "/tmp/cb_test_resultdb.dat";
+static const char *g_index_path = "/tmp/cb_test_resultdb.idx";
+
+static void remove_db(void)
+{
+    remove(g_data_path);
+    remove(g_index_path);
+}
+
+/**
+ * @brief Build a result with a given identity and timestamp
+ */
+static void make_result(cb_result_t *result, const char *platform,
+                        uint64_t timestamp, uint64_t mean_ns)
+{
+    memset(result, 0, sizeof(*result));
+    strncpy(result->platform, platform, CB_MAX_PLATFORM - 1);
+    strncpy(result->cpu_model, "Test CPU", CB_MAX_CPU_MODEL - 1);
+    cb_compute_hash("model", 5, &result->output_hash);
+    result->timestamp_unix = timestamp;
+    result->latency.mean_ns = mean_ns;
+    result->latency.sample_count = 100;
+}
+
+/**
+ * @brief Key for the identity make_result() assigns to a platform
+ */
+static uint64_t key_for(const char *platform)
+{
+    cb_hash_t model_hash;
+    uint64_t key = 0;
+
+    cb_compute_hash("model", 5, &model_hash);
+    cb_resultdb_make_key(platform, "Test CPU", &model_hash, &key);
+    return key;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Database Lifecycle (SRS-008-RESULTDB §4.1)
+ * Traceability: RESULTDB-F-001 through RESULTDB-F-006
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Test create, close, and persistent reopen
+ * @satisfies RESULTDB-F-001 through RESULTDB-F-006
+ */
+static int test_db_lifecycle(void)
+{
+    cb_resultdb_t db;
+    cb_result_t result;
+
+    remove_db();
+
+    TEST_ASSERT_EQ(cb_resultdb_open(&db, g_data_path, g_index_path), CB_OK,
+                   "fresh database created");
+    TEST_ASSERT_EQ(cb_resultdb_count(&db), 0, "fresh database is empty");
+
+    make_result(&result, "x86_64", 1000, 500);
+    TEST_ASSERT_EQ(cb_resultdb_append(&db, &result), CB_OK,
+                   "append should succeed");
+    TEST_ASSERT_EQ(cb_resultdb_count(&db), 1, "count reflects append");
+    TEST_ASSERT_EQ(cb_resultdb_close(&db), CB_OK, "close should succeed");
+
+    /* The record and index survive the process boundary */
+    TEST_ASSERT_EQ(cb_resultdb_open(&db, g_data_path, g_index_path), CB_OK,
+                   "reopen should succeed");
+    TEST_ASSERT_EQ(cb_resultdb_count(&db), 1, "count persists across reopen");
+    cb_resultdb_close(&db);
+
+    remove_db();
+    return 0;
+}
+
+/**
+ * @brief Test invalid lifecycle arguments
+ * @satisfies RESULTDB-F-001, RESULTDB-F-005
+ */
+static int test_db_invalid(void)
+{
+    cb_resultdb_t db;
+    cb_result_t result;
+    cb_resultdb_entry_t entries[4];
+    uint32_t count;
+
+    TEST_ASSERT_EQ(cb_resultdb_open(NULL, g_data_path, g_index_path),
+                   CB_ERR_NULL_PTR, "NULL handle rejected");
+    TEST_ASSERT_EQ(cb_resultdb_open(&db, NULL, g_index_path),
+                   CB_ERR_NULL_PTR, "NULL data path rejected");
+
+    memset(&db, 0, sizeof(db));
+    make_result(&result, "x86_64", 1, 1);
+    TEST_ASSERT_EQ(cb_resultdb_append(&db, &result), CB_ERR_INVALID_CONFIG,
+                   "append on closed handle rejected");
+    TEST_ASSERT_EQ(cb_resultdb_query(&db, 0, 0, 1, entries, 4, &count),
+                   CB_ERR_INVALID_CONFIG, "query on closed handle rejected");
+    TEST_ASSERT_EQ(cb_resultdb_close(&db), CB_ERR_INVALID_CONFIG,
+                   "close of closed handle rejected");
+    TEST_ASSERT_EQ(cb_resultdb_count(&db), 0, "closed handle counts zero");
+
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Queries (SRS-008-RESULTDB §4.2, §4.3)
+ * Traceability: RESULTDB-F-010 through RESULTDB-F-023
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Test range queries over out-of-order appends
+ * @satisfies RESULTDB-F-011 through RESULTDB-F-021
+ */
+static int test_range_query(void)
+{
+    cb_resultdb_t db;
+    cb_result_t result;
+    cb_resultdb_entry_t entries[16];
+    uint32_t count, i;
+    /* Timestamps appended out of order: sorted insertion must fix it */
+    static const uint64_t stamps[] = { 500, 100, 400, 200, 300 };
+
+    remove_db();
+    cb_resultdb_open(&db, g_data_path, g_index_path);
+
+    for (i = 0; i < 5; i++) {
+        make_result(&result, "x86_64", stamps[i], stamps[i] * 10);
+        TEST_ASSERT_EQ(cb_resultdb_append(&db, &result), CB_OK,
+                       "append should succeed");
+    }
+    /* A second identity must not pollute the first key's results */
+    make_result(&result, "arm64", 250, 999);
+    cb_resultdb_append(&db, &result);
+
+    TEST_ASSERT_EQ(cb_resultdb_query(&db, key_for("x86_64"), 150, 450,
+                                     entries, 16, &count),
+                   CB_OK, "range query should succeed");
+    TEST_ASSERT_EQ(count, 3, "three entries inside [150, 450]");
+    TEST_ASSERT_EQ(entries[0].timestamp_unix, 200, "ascending order");
+    TEST_ASSERT_EQ(entries[1].timestamp_unix, 300, "ascending order");
+    TEST_ASSERT_EQ(entries[2].timestamp_unix, 400, "ascending order");
+
+    /* Undersized output array is an error, not silent truncation */
+    TEST_ASSERT_EQ(cb_resultdb_query(&db, key_for("x86_64"), 0, UINT64_MAX,
+                                     entries, 2, &count),
+                   CB_ERR_OUT_OF_MEMORY, "overfull query rejected");
+
+    cb_resultdb_close(&db);
+    remove_db();
+    return 0;
+}
+
+/**
+ * @brief Test latest-N lookup and record loading
+ * @satisfies RESULTDB-F-022, RESULTDB-F-023
+ */
+static int test_latest_and_load(void)
+{
+    cb_resultdb_t db;
+    cb_result_t result;
+    cb_resultdb_entry_t entries[8];
+    uint32_t count, i;
+
+    remove_db();
+    cb_resultdb_open(&db, g_data_path, g_index_path);
+
+    for (i = 1; i <= 5; i++) {
+        make_result(&result, "x86_64", i * 100, i * 1000);
+        /* A live forensic ring pointer must not reach the database —
+         * records are framed exactly as cb_write_binary() */
+        result.forensic_ring = (const cb_forensic_t *)&result;
+        result.forensic_captured = 7;
+        result.forensic_capacity = 8;
+        cb_resultdb_append(&db, &result);
+    }
+
+    TEST_ASSERT_EQ(cb_resultdb_latest(&db, key_for("x86_64"), 3,
+                                      entries, &count),
+                   CB_OK, "latest-N should succeed");
+    TEST_ASSERT_EQ(count, 3, "three baselines returned");
+    TEST_ASSERT_EQ(entries[0].timestamp_unix, 500, "newest first");
+    TEST_ASSERT_EQ(entries[1].timestamp_unix, 400, "descending order");
+    TEST_ASSERT_EQ(entries[2].timestamp_unix, 300, "descending order");
+
+    /* The stored record comes back intact and integrity-checked */
+    TEST_ASSERT_EQ(cb_resultdb_load(&db, &entries[0], &result), CB_OK,
+                   "load should succeed");
+    TEST_ASSERT_EQ(result.latency.mean_ns, 5000, "payload round-trips");
+    TEST_ASSERT_EQ(result.timestamp_unix, 500, "timestamp round-trips");
+    TEST_ASSERT(result.forensic_ring == NULL,
+                "stale ring pointer never crosses processes");
+    TEST_ASSERT_EQ(result.forensic_capacity, 0, "ring capacity cleared");
+    TEST_ASSERT_EQ(result.forensic_captured, 7, "capture count round-trips");
+
+    /* Asking for more baselines than exist returns what there is */
+    cb_resultdb_latest(&db, key_for("x86_64"), 8, entries, &count);
+    TEST_ASSERT_EQ(count, 5, "short history returned in full");
+
+    /* An unknown key matches nothing */
+    cb_resultdb_latest(&db, key_for("riscv64"), 3, entries, &count);
+    TEST_ASSERT_EQ(count, 0, "unknown identity has no baselines");
+
+    cb_resultdb_close(&db);
+    remove_db();
+    return 0;
+}
+
+/**
+ * @brief Test index growth past the initial allocation block
+ * @satisfies RESULTDB-F-013
+ */
+static int test_index_growth(void)
+{
+    cb_resultdb_t db;
+    cb_result_t result;
+    cb_resultdb_entry_t entries[4];
+    uint32_t count, i;
+
+    remove_db();
+    cb_resultdb_open(&db, g_data_path, g_index_path);
+
+    /* 1100 entries crosses the 1024-entry growth block */
+    for (i = 0; i < 1100; i++) {
+        make_result(&result, "x86_64", i, i);
+        TEST_ASSERT_EQ(cb_resultdb_append(&db, &result), CB_OK,
+                       "append across growth should succeed");
+    }
+    TEST_ASSERT_EQ(cb_resultdb_count(&db), 1100, "all entries present");
+
+    cb_resultdb_latest(&db, key_for("x86_64"), 1, entries, &count);
+    TEST_ASSERT_EQ(count, 1, "latest found after growth");
+    TEST_ASSERT_EQ(entries[0].timestamp_unix, 1099, "newest entry correct");
+
+    cb_resultdb_close(&db);
+    remove_db();
+    return 0;
+}
+
+/**
+ * @brief Test key derivation distinguishes identities
+ * @satisfies RESULTDB-F-010
+ */
+static int test_make_key(void)
+{
+    cb_hash_t hash_a, hash_b;
+    uint64_t k1, k2, k3;
+
+    cb_compute_hash("model-a", 7, &hash_a);
+    cb_compute_hash("model-b", 7, &hash_b);
+
+    cb_resultdb_make_key("x86_64", "CPU", &hash_a, &k1);
+    cb_resultdb_make_key("x86_64", "CPU", &hash_a, &k2);
+    TEST_ASSERT_EQ(k1, k2, "same identity gives same key");
+
+    cb_resultdb_make_key("x86_64", "CPU", &hash_b, &k3);
+    TEST_ASSERT_NE(k1, k3, "different model gives different key");
+
+    cb_resultdb_make_key("arm64", "CPU", &hash_a, &k3);
+    TEST_ASSERT_NE(k1, k3, "different platform gives different key");
+
+    TEST_ASSERT_EQ(cb_resultdb_make_key(NULL, "CPU", &hash_a, &k1),
+                   CB_ERR_NULL_PTR, "NULL platform rejected");
+
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Main Test Runner
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+int main(void)
+{
+    printf("═══════════════════════════════════════════════════════════════════\n");
+    printf(" certifiable-bench Result Database Tests\n");
+    printf(" @traceability SRS-008-RESULTDB\n");
+    printf("═══════════════════════════════════════════════════════════════════\n");
+
+    printf("\n§4.1 Database Lifecycle (RESULTDB-F-001..006)\n");
+    RUN_TEST(test_db_lifecycle);
+    RUN_TEST(test_db_invalid);
+
+    printf("\n§4.2 Keys and Insertion (RESULTDB-F-010..014)\n");
+    RUN_TEST(test_make_key);
+    RUN_TEST(test_index_growth);
+
+    printf("\n§4.3 Queries (RESULTDB-F-020..023)\n");
+    RUN_TEST(test_range_query);
+    RUN_TEST(test_latest_and_load);
+
+    printf("\n═══════════════════════════════════════════════════════════════════\n");
+    printf(" Results\n");
+    printf("═══════════════════════════════════════════════════════════════════\n");
+    printf(" Tests run:    %d\n", g_tests_run);
+    printf(" Tests passed: %d\n", g_tests_passed);
+    printf(" Tests failed: %d\n", g_tests_failed);
+    printf("═══════════════════════════════════════════════════════════════════\n");
+
+    if (g_tests_failed > 0) {
+        printf("\n*** FAILURES DETECTED ***\n");
+        return 1;
+    }
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
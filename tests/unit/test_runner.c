@@ -15,6 +15,7 @@
 #include "cb_timer.h"
 #include "cb_metrics.h"
 #include "cb_verify.h"
+#include "cb_data.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -49,6 +50,7 @@ static uint64_t g_sample_buffer[TEST_SAMPLE_CAPACITY];
 #define TEST_ASSERT_GT(a, b, msg) TEST_ASSERT((a) > (b), msg)
 #define TEST_ASSERT_GE(a, b, msg) TEST_ASSERT((a) >= (b), msg)
 #define TEST_ASSERT_LT(a, b, msg) TEST_ASSERT((a) < (b), msg)
+#define TEST_ASSERT_LE(a, b, msg) TEST_ASSERT((a) <= (b), msg)
 
 #define RUN_TEST(fn) do { \
     printf("  %s\n", #fn); \
@@ -271,6 +273,783 @@ static int test_execute_positive_samples(void)
     return 0;
 }
 
+static int test_execute_batched_timing(void)
+{
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    uint8_t input[64], output[64];
+    cb_config_init(&config);
+    config.warmup_iterations = 5;
+    config.measure_iterations = 50;
+    config.timing_batch = 8;
+    config.verify_outputs = false;
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    g_inference_count = 0;
+    cb_runner_execute(&runner, mock_inference_work, NULL,
+                      input, sizeof(input), output, sizeof(output));
+    /* Each of the 50 samples covers 8 back-to-back calls */
+    TEST_ASSERT_EQ(g_inference_count, 5 + 50 * 8, "total = warmup + measure×k");
+    TEST_ASSERT_EQ(runner.samples_collected, 50, "one sample per group");
+    cb_runner_get_result(&runner, &result);
+    TEST_ASSERT_EQ(result.timing_batch, 8, "timing_batch echoed in result");
+    TEST_ASSERT_GT(result.latency.mean_ns, 0, "per-call mean positive");
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+static int test_execute_timing_batch_zero(void)
+{
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    uint8_t input[64], output[64];
+    cb_config_init(&config);
+    config.warmup_iterations = 2;
+    config.measure_iterations = 20;
+    config.timing_batch = 0;  /* Legacy zeroed config — treated as 1 */
+    config.verify_outputs = false;
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    g_inference_count = 0;
+    cb_runner_execute(&runner, mock_inference_copy, NULL,
+                      input, sizeof(input), output, sizeof(output));
+    TEST_ASSERT_EQ(g_inference_count, 22, "timing_batch=0 behaves as 1");
+    cb_runner_get_result(&runner, &result);
+    TEST_ASSERT_EQ(result.timing_batch, 1, "normalised to 1 in result");
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Execution Isolation (SRS-003-RUNNER §4.9)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+static int test_isolation_applied(void)
+{
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    uint8_t input[64], output[64];
+    cb_config_init(&config);
+    TEST_ASSERT(!config.isolate, "isolation off by default");
+    TEST_ASSERT(config.isolate_mlock, "mlock on by default when isolating");
+    config.warmup_iterations = 2;
+    config.measure_iterations = 20;
+    config.isolate = true;
+    config.isolate_core = 0;
+    config.verify_outputs = false;
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    TEST_ASSERT_EQ(cb_runner_execute(&runner, mock_inference_copy, NULL,
+                                     input, sizeof(input),
+                                     output, sizeof(output)),
+                   CB_OK, "isolated run succeeds");
+    TEST_ASSERT_EQ(runner.samples_collected, 20, "samples collected");
+    cb_runner_get_result(&runner, &result);
+#ifdef __linux__
+    TEST_ASSERT(result.isolation_active, "isolation recorded active");
+    TEST_ASSERT_EQ(result.isolation_core, 0, "pinned core recorded");
+#else
+    TEST_ASSERT(!result.isolation_active, "no isolation on this platform");
+#endif
+    TEST_ASSERT(!result.isolation_priority, "priority not requested");
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+static int test_isolation_bad_core(void)
+{
+#ifdef __linux__
+    cb_runner_t runner;
+    cb_config_t config;
+    uint8_t input[64], output[64];
+    cb_config_init(&config);
+    config.warmup_iterations = 2;
+    config.measure_iterations = 20;
+    config.isolate = true;
+    config.isolate_core = 1023;  /* Not present on any reasonable host */
+    config.verify_outputs = false;
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    TEST_ASSERT_EQ(cb_runner_execute(&runner, mock_inference_copy, NULL,
+                                     input, sizeof(input),
+                                     output, sizeof(output)),
+                   CB_ERR_INVALID_CONFIG, "unpinnable core rejected");
+    cb_runner_cleanup(&runner);
+#endif
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Adaptive Stopping (SRS-003-RUNNER §4.11)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+static int test_adaptive_stop_converges(void)
+{
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    uint8_t input[64], output[64];
+
+    cb_config_init(&config);
+    config.warmup_iterations = 10;
+    config.measure_iterations = TEST_SAMPLE_CAPACITY;
+    config.adaptive_stop = true;
+    config.ci_rel_q16 = 6554;        /* 10% — loose, robust to noise */
+    config.ci_check_interval = 50;
+    config.ci_min_iterations = 100;
+    config.verify_outputs = false;
+
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    cb_runner_execute(&runner, mock_inference_work, NULL,
+                      input, sizeof(input), output, sizeof(output));
+    cb_runner_get_result(&runner, &result);
+
+    TEST_ASSERT(result.adaptive_stop, "adaptive mode echoed in result");
+    TEST_ASSERT_GE(result.latency.sample_count, 100,
+                   "never stops below ci_min_iterations");
+    TEST_ASSERT_LE(result.latency.sample_count, TEST_SAMPLE_CAPACITY,
+                   "never exceeds the cap");
+
+    if (result.stopped_early) {
+        TEST_ASSERT_LT(result.latency.sample_count, TEST_SAMPLE_CAPACITY,
+                       "early stop collects fewer than the cap");
+        TEST_ASSERT_LE(result.ci_achieved_q16, config.ci_rel_q16,
+                       "achieved precision meets the target");
+    } else {
+        TEST_ASSERT_EQ(result.latency.sample_count, TEST_SAMPLE_CAPACITY,
+                       "without early stop the cap is exhausted");
+    }
+
+    printf("    Collected %u samples, CI half-width %u.%02u%%\n",
+           result.latency.sample_count,
+           (result.ci_achieved_q16 * 100) >> 16,
+           (((result.ci_achieved_q16 * 100) & 0xFFFF) * 100) >> 16);
+
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+static int test_adaptive_stop_cap(void)
+{
+    /* An unreachable target must run to the cap and record the
+     * precision actually achieved */
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    uint8_t input[64], output[64];
+
+    cb_config_init(&config);
+    config.warmup_iterations = 2;
+    config.measure_iterations = 300;
+    config.adaptive_stop = true;
+    config.ci_rel_q16 = 1;           /* ~0.0015% — unreachable */
+    config.ci_check_interval = 50;
+    config.ci_min_iterations = 50;
+    config.verify_outputs = false;
+
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    cb_runner_execute(&runner, mock_inference_work, NULL,
+                      input, sizeof(input), output, sizeof(output));
+    cb_runner_get_result(&runner, &result);
+
+    TEST_ASSERT_EQ(result.latency.sample_count, 300, "cap exhausted");
+    TEST_ASSERT(!result.stopped_early, "no early stop recorded");
+    TEST_ASSERT_GT(result.ci_achieved_q16, 0, "achieved precision recorded");
+
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+static int test_adaptive_stop_invalid(void)
+{
+    cb_runner_t runner;
+    cb_config_t config;
+
+    cb_config_init(&config);
+    config.adaptive_stop = true;
+    config.ci_rel_q16 = 0;           /* Target of zero is meaningless */
+
+    TEST_ASSERT_EQ(cb_runner_init(&runner, &config, g_sample_buffer,
+                                  TEST_SAMPLE_CAPACITY),
+                   CB_ERR_INVALID_CONFIG, "zero CI target rejected");
+
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Adaptive Warmup (SRS-003-RUNNER §4.3)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+static int test_adaptive_warmup_converges(void)
+{
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    uint8_t input[64], output[64];
+
+    cb_config_init(&config);
+    config.warmup_iterations = 500;  /* Hard cap */
+    config.measure_iterations = 50;
+    config.adaptive_warmup = true;
+    config.warmup_window = 8;
+    config.warmup_drift_q16 = 32768; /* 50% — loose, robust to noise */
+    config.verify_outputs = false;
+
+    g_inference_count = 0;
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    cb_runner_execute(&runner, mock_inference_work, NULL,
+                      input, sizeof(input), output, sizeof(output));
+    cb_runner_get_result(&runner, &result);
+
+    TEST_ASSERT_GE(result.warmup_consumed, 16,
+                   "convergence needs at least two full windows");
+    TEST_ASSERT_LE(result.warmup_consumed, 500, "cap never exceeded");
+    TEST_ASSERT_EQ(g_inference_count, result.warmup_consumed + 50,
+                   "recorded count matches calls actually made");
+
+    printf("    Warmup consumed %u of %u iterations\n",
+           result.warmup_consumed, config.warmup_iterations);
+
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+static int test_adaptive_warmup_cap(void)
+{
+    /* A window wider than the cap never yields two means to compare,
+     * so warmup must run to the cap exactly as in fixed mode */
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    uint8_t input[64], output[64];
+
+    cb_config_init(&config);
+    config.warmup_iterations = 50;
+    config.measure_iterations = 20;
+    config.adaptive_warmup = true;
+    config.warmup_window = 100;      /* Wider than the cap */
+    config.verify_outputs = false;
+
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    cb_runner_execute(&runner, mock_inference_work, NULL,
+                      input, sizeof(input), output, sizeof(output));
+    cb_runner_get_result(&runner, &result);
+
+    TEST_ASSERT_EQ(result.warmup_consumed, 50, "cap exhausted");
+
+    cb_runner_cleanup(&runner);
+
+    /* Fixed mode records the configured count verbatim */
+    config.adaptive_warmup = false;
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    cb_runner_execute(&runner, mock_inference_work, NULL,
+                      input, sizeof(input), output, sizeof(output));
+    cb_runner_get_result(&runner, &result);
+
+    TEST_ASSERT_EQ(result.warmup_consumed, 50, "fixed count recorded");
+
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+static int test_adaptive_warmup_invalid(void)
+{
+    cb_runner_t runner;
+    cb_config_t config;
+
+    cb_config_init(&config);
+    config.adaptive_warmup = true;
+    config.warmup_drift_q16 = 0;     /* Threshold of zero is meaningless */
+
+    TEST_ASSERT_EQ(cb_runner_init(&runner, &config, g_sample_buffer,
+                                  TEST_SAMPLE_CAPACITY),
+                   CB_ERR_INVALID_CONFIG, "zero drift threshold rejected");
+
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Cold-Cache Mode (SRS-003-RUNNER §4.14)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+static uint8_t g_cold_weights[16384];
+
+static int test_cold_cache_mode(void)
+{
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    uint8_t input[64], output[64];
+
+    cb_config_init(&config);
+    config.warmup_iterations = 10;
+    config.measure_iterations = 50;
+    config.cold_cache = true;
+    config.cold_flush_base = g_cold_weights;
+    config.cold_flush_size = sizeof(g_cold_weights);
+    config.verify_outputs = false;
+
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    TEST_ASSERT_EQ(cb_runner_execute(&runner, mock_inference_work, NULL,
+                                     input, sizeof(input),
+                                     output, sizeof(output)),
+                   CB_OK, "cold-cache run should succeed");
+    cb_runner_get_result(&runner, &result);
+
+    TEST_ASSERT(result.cold_cache, "measurement mode recorded");
+    TEST_ASSERT_EQ(result.latency.sample_count, 50, "all samples collected");
+
+    cb_runner_cleanup(&runner);
+
+    /* Warm runs must record the warm mode */
+    config.cold_cache = false;
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    cb_runner_execute(&runner, mock_inference_work, NULL,
+                      input, sizeof(input), output, sizeof(output));
+    cb_runner_get_result(&runner, &result);
+    TEST_ASSERT(!result.cold_cache, "warm mode recorded");
+
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+static int test_cold_cache_invalid(void)
+{
+    cb_runner_t runner;
+    cb_config_t config;
+
+    cb_config_init(&config);
+    config.cold_flush_size = 4096;   /* Size without a base */
+
+    TEST_ASSERT_EQ(cb_runner_init(&runner, &config, g_sample_buffer,
+                                  TEST_SAMPLE_CAPACITY),
+                   CB_ERR_INVALID_CONFIG, "dangling flush range rejected");
+
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Outlier Forensics (SRS-003-RUNNER §4.15)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#define TEST_FORENSIC_SLOTS 8
+
+static cb_forensic_t g_forensic_ring[TEST_FORENSIC_SLOTS];
+
+static int test_forensics_capture(void)
+{
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    uint8_t input[64], output[64];
+    uint32_t i;
+
+    cb_config_init(&config);
+    config.warmup_iterations = 5;
+    config.measure_iterations = 100;
+    config.verify_outputs = false;
+
+    /* A 1 ns threshold marks every sample an outlier — the count keeps
+     * climbing while the ring wraps */
+    config.forensic_threshold_ns = 1;
+    config.forensic_ring = g_forensic_ring;
+    config.forensic_capacity = TEST_FORENSIC_SLOTS;
+
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    TEST_ASSERT_EQ(cb_runner_execute(&runner, mock_inference_work, NULL,
+                                     input, sizeof(input),
+                                     output, sizeof(output)),
+                   CB_OK, "forensic run should succeed");
+    cb_runner_get_result(&runner, &result);
+
+    TEST_ASSERT_EQ(result.forensic_captured, 100, "every sample captured");
+    TEST_ASSERT_EQ(result.forensic_capacity, TEST_FORENSIC_SLOTS,
+                   "capacity echoed");
+    TEST_ASSERT(result.forensic_ring == g_forensic_ring, "ring echoed");
+
+    for (i = 0; i < TEST_FORENSIC_SLOTS; i++) {
+        TEST_ASSERT_GT(g_forensic_ring[i].latency_ns, 0,
+                       "record carries the sample latency");
+        TEST_ASSERT_LT(g_forensic_ring[i].iteration, 100,
+                       "iteration index in range");
+    }
+
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+static int test_forensics_quiet(void)
+{
+    /* An unreachable threshold must leave the ring untouched — the
+     * capture path never fires on well-behaved samples */
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    uint8_t input[64], output[64];
+
+    cb_config_init(&config);
+    config.warmup_iterations = 5;
+    config.measure_iterations = 50;
+    config.verify_outputs = false;
+    config.forensic_threshold_ns = UINT64_MAX;
+    config.forensic_ring = g_forensic_ring;
+    config.forensic_capacity = TEST_FORENSIC_SLOTS;
+
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    cb_runner_execute(&runner, mock_inference_work, NULL,
+                      input, sizeof(input), output, sizeof(output));
+    cb_runner_get_result(&runner, &result);
+
+    TEST_ASSERT_EQ(result.forensic_captured, 0, "no tail samples captured");
+    TEST_ASSERT_EQ(result.latency.sample_count, 50, "all samples collected");
+
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+static int test_forensics_invalid(void)
+{
+    cb_runner_t runner;
+    cb_config_t config;
+
+    cb_config_init(&config);
+    config.forensic_threshold_ns = 1000;   /* Threshold without a ring */
+
+    TEST_ASSERT_EQ(cb_runner_init(&runner, &config, g_sample_buffer,
+                                  TEST_SAMPLE_CAPACITY),
+                   CB_ERR_INVALID_CONFIG, "missing ring rejected");
+
+    config.forensic_ring = g_forensic_ring;
+    config.forensic_capacity = 0;          /* Ring without slots */
+    TEST_ASSERT_EQ(cb_runner_init(&runner, &config, g_sample_buffer,
+                                  TEST_SAMPLE_CAPACITY),
+                   CB_ERR_INVALID_CONFIG, "empty ring rejected");
+
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Streaming Throughput (SRS-003-RUNNER §4.16)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#define STREAM_RECORD_SIZE 64U
+#define STREAM_NUM_RECORDS 256U
+
+/**
+ * @brief Write a corpus of STREAM_NUM_RECORDS fixed-size records
+ */
+static int create_stream_corpus(const char *path)
+{
+    FILE *fp = fopen(path, "wb");
+    uint8_t record[STREAM_RECORD_SIZE];
+    uint32_t i, j;
+
+    if (fp == NULL) return -1;
+    for (i = 0; i < STREAM_NUM_RECORDS; i++) {
+        for (j = 0; j < STREAM_RECORD_SIZE; j++) {
+            record[j] = (uint8_t)(i + j);
+        }
+        if (fwrite(record, sizeof(record), 1, fp) != 1) {
+            fclose(fp);
+            return -1;
+        }
+    }
+    fclose(fp);
+    return 0;
+}
+
+static int test_streaming_throughput(void)
+{
+    const char *path = "/tmp/cb_test_stream.bin";
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    cb_data_map_t map;
+    uint8_t output[STREAM_RECORD_SIZE];
+
+    TEST_ASSERT_EQ(create_stream_corpus(path), 0, "corpus created");
+    TEST_ASSERT_EQ(cb_data_map(&map, path, true), CB_OK, "corpus mapped");
+
+    cb_config_init(&config);
+    config.warmup_iterations = 10;
+    config.measure_iterations = 200;
+    config.verify_outputs = false;
+
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    TEST_ASSERT_EQ(cb_runner_execute_streaming(&runner, mock_inference_copy,
+                                               NULL, &map,
+                                               STREAM_RECORD_SIZE,
+                                               3, true,
+                                               output, sizeof(output)),
+                   CB_OK, "streaming run should succeed");
+    cb_runner_get_result(&runner, &result);
+
+    TEST_ASSERT(result.streaming, "streaming mode recorded");
+    TEST_ASSERT_EQ(result.latency.sample_count, 200, "all samples collected");
+    TEST_ASSERT_GT(result.throughput.inferences_per_sec, 0,
+                   "sustained inference rate measured");
+    /* 64-byte records: the byte rate must dominate the inference rate */
+    TEST_ASSERT_GT(result.throughput.bytes_per_sec,
+                   result.throughput.inferences_per_sec,
+                   "input traffic measured");
+
+    printf("    sustained %lu inf/s, %lu bytes/s\n",
+           (unsigned long)result.throughput.inferences_per_sec,
+           (unsigned long)result.throughput.bytes_per_sec);
+
+    cb_runner_cleanup(&runner);
+    cb_data_unmap(&map);
+    remove(path);
+    return 0;
+}
+
+static int test_streaming_invalid(void)
+{
+    const char *path = "/tmp/cb_test_stream.bin";
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_data_map_t map;
+    uint8_t output[STREAM_RECORD_SIZE];
+
+    TEST_ASSERT_EQ(create_stream_corpus(path), 0, "corpus created");
+    TEST_ASSERT_EQ(cb_data_map(&map, path, false), CB_OK, "corpus mapped");
+
+    cb_config_init(&config);
+    config.warmup_iterations = 1;
+    config.measure_iterations = 10;
+    config.verify_outputs = false;
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+
+    TEST_ASSERT_EQ(cb_runner_execute_streaming(&runner, mock_inference_copy,
+                                               NULL, NULL,
+                                               STREAM_RECORD_SIZE, 1, false,
+                                               output, sizeof(output)),
+                   CB_ERR_NULL_PTR, "NULL map rejected");
+    TEST_ASSERT_EQ(cb_runner_execute_streaming(&runner, mock_inference_copy,
+                                               NULL, &map, 0, 1, false,
+                                               output, sizeof(output)),
+                   CB_ERR_INVALID_CONFIG, "zero record size rejected");
+    TEST_ASSERT_EQ(cb_runner_execute_streaming(&runner, mock_inference_copy,
+                                               NULL, &map,
+                                               UINT32_MAX, 1, false,
+                                               output, sizeof(output)),
+                   CB_ERR_INVALID_CONFIG,
+                   "record larger than the corpus rejected");
+
+    /* §4.14 does not combine with streaming — accepting the flag
+     * would stamp warm-path samples as cold-start */
+    runner.config.cold_cache = true;
+    TEST_ASSERT_EQ(cb_runner_execute_streaming(&runner, mock_inference_copy,
+                                               NULL, &map,
+                                               STREAM_RECORD_SIZE, 1, false,
+                                               output, sizeof(output)),
+                   CB_ERR_INVALID_CONFIG, "cold-cache streaming rejected");
+    runner.config.cold_cache = false;
+
+    cb_runner_cleanup(&runner);
+    cb_data_unmap(&map);
+    remove(path);
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Overhead Accounting (SRS-003-RUNNER §4.12)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+static int test_overhead_accounting(void)
+{
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    uint8_t input[64], output[64];
+
+    cb_config_init(&config);
+    config.warmup_iterations = 20;
+    config.measure_iterations = 100;
+    config.verify_outputs = true;
+
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    cb_runner_execute(&runner, mock_inference_work, NULL,
+                      input, sizeof(input), output, sizeof(output));
+    cb_runner_get_result(&runner, &result);
+
+    TEST_ASSERT_GT(result.overhead.warmup_ns, 0, "warmup phase accounted");
+    TEST_ASSERT_GT(result.overhead.timed_ns, 0, "timed regions accounted");
+    TEST_ASSERT_GT(result.overhead.verify_ns, 0, "verify phase accounted");
+    TEST_ASSERT_GT(result.overhead.stats_ns, 0, "stats phase accounted");
+    TEST_ASSERT_GE(result.overhead.total_ns,
+                   result.overhead.warmup_ns + result.overhead.timed_ns,
+                   "total bounds the phases it contains");
+
+    printf("    warmup %lu ns, timed %lu ns, verify %lu ns, stats %lu ns,"
+           " total %lu ns\n",
+           (unsigned long)result.overhead.warmup_ns,
+           (unsigned long)result.overhead.timed_ns,
+           (unsigned long)result.overhead.verify_ns,
+           (unsigned long)result.overhead.stats_ns,
+           (unsigned long)result.overhead.total_ns);
+
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+static int test_overhead_no_verify(void)
+{
+    /* With verification disabled no time may be charged to the verify
+     * phase */
+    cb_runner_t runner;
+    cb_config_t config;
+    cb_result_t result;
+    uint8_t input[64], output[64];
+
+    cb_config_init(&config);
+    config.warmup_iterations = 5;
+    config.measure_iterations = 50;
+    config.verify_outputs = false;
+
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    cb_runner_execute(&runner, mock_inference_work, NULL,
+                      input, sizeof(input), output, sizeof(output));
+    cb_runner_get_result(&runner, &result);
+
+    TEST_ASSERT_EQ(result.overhead.verify_ns, 0, "verify phase empty");
+    TEST_ASSERT_GT(result.overhead.timed_ns, 0, "timed regions accounted");
+
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Interleaved A/B Execution (RUNNER-F-090..095)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+static int test_interleaved_ab(void)
+{
+    static uint64_t samples_a[64], samples_b[64];
+    cb_config_t config;
+    cb_ab_variant_t variant_a, variant_b;
+    cb_result_t result_a, result_b;
+    uint8_t input[64], output_a[64], output_b[64];
+    cb_result_code_t rc;
+
+    memset(input, 0xA5, sizeof(input));
+    cb_config_init(&config);
+    config.warmup_iterations = 5;
+    config.measure_iterations = 64;
+
+    memset(&variant_a, 0, sizeof(variant_a));
+    variant_a.fn = mock_inference_copy;
+    variant_a.input = input;
+    variant_a.output = output_a;
+    variant_a.samples = samples_a;
+    variant_a.sample_capacity = 64;
+
+    variant_b = variant_a;
+    variant_b.fn = mock_inference_work;
+    variant_b.output = output_b;
+    variant_b.samples = samples_b;
+
+    rc = cb_runner_execute_interleaved(&config, &variant_a, &variant_b,
+                                       sizeof(input), sizeof(output_a),
+                                       8, &result_a, &result_b);
+    TEST_ASSERT_EQ(rc, CB_OK, "interleaved execution should succeed");
+
+    TEST_ASSERT_EQ(result_a.latency.sample_count, 64, "A collected all samples");
+    TEST_ASSERT_EQ(result_b.latency.sample_count, 64, "B collected all samples");
+    TEST_ASSERT_GT(result_a.latency.mean_ns, 0, "A mean positive");
+
+    /* mock_inference_work does ~1000 multiplies; copy moves 64 bytes —
+     * an order of magnitude apart, robust to scheduler noise */
+    TEST_ASSERT_GT(result_b.latency.mean_ns, result_a.latency.mean_ns,
+                   "heavier variant should measure slower");
+
+    TEST_ASSERT(result_a.determinism_verified, "A outputs deterministic");
+    TEST_ASSERT(result_b.determinism_verified, "B outputs deterministic");
+
+    return 0;
+}
+
+static int test_interleaved_block_one(void)
+{
+    /* block_size 0 degrades to per-iteration alternation, not an error */
+    static uint64_t samples_a[16], samples_b[16];
+    cb_config_t config;
+    cb_ab_variant_t variant_a, variant_b;
+    cb_result_t result_a, result_b;
+    uint8_t input[64], output_a[64], output_b[64];
+    cb_result_code_t rc;
+
+    memset(input, 0x5A, sizeof(input));
+    cb_config_init(&config);
+    config.warmup_iterations = 2;
+    config.measure_iterations = 16;
+    config.verify_outputs = false;
+
+    memset(&variant_a, 0, sizeof(variant_a));
+    variant_a.fn = mock_inference_copy;
+    variant_a.input = input;
+    variant_a.output = output_a;
+    variant_a.samples = samples_a;
+    variant_a.sample_capacity = 16;
+
+    variant_b = variant_a;
+    variant_b.output = output_b;
+    variant_b.samples = samples_b;
+
+    rc = cb_runner_execute_interleaved(&config, &variant_a, &variant_b,
+                                       sizeof(input), sizeof(output_a),
+                                       0, &result_a, &result_b);
+    TEST_ASSERT_EQ(rc, CB_OK, "zero block size should behave as one");
+    TEST_ASSERT_EQ(result_a.latency.sample_count, 16, "A collected all samples");
+    TEST_ASSERT_EQ(result_b.latency.sample_count, 16, "B collected all samples");
+
+    return 0;
+}
+
+static int test_interleaved_invalid(void)
+{
+    static uint64_t samples_a[16], samples_b[16];
+    cb_config_t config;
+    cb_ab_variant_t variant_a, variant_b;
+    cb_result_t result_a, result_b;
+    uint8_t input[64], output_a[64], output_b[64];
+    cb_result_code_t rc;
+
+    cb_config_init(&config);
+    config.warmup_iterations = 2;
+    config.measure_iterations = 16;
+
+    memset(&variant_a, 0, sizeof(variant_a));
+    variant_a.fn = mock_inference_copy;
+    variant_a.input = input;
+    variant_a.output = output_a;
+    variant_a.samples = samples_a;
+    variant_a.sample_capacity = 16;
+
+    variant_b = variant_a;
+    variant_b.output = output_b;
+    variant_b.samples = samples_b;
+
+    rc = cb_runner_execute_interleaved(NULL, &variant_a, &variant_b,
+                                       sizeof(input), sizeof(output_a),
+                                       4, &result_a, &result_b);
+    TEST_ASSERT_EQ(rc, CB_ERR_NULL_PTR, "NULL config should fail");
+
+    variant_b.fn = NULL;
+    rc = cb_runner_execute_interleaved(&config, &variant_a, &variant_b,
+                                       sizeof(input), sizeof(output_a),
+                                       4, &result_a, &result_b);
+    TEST_ASSERT_EQ(rc, CB_ERR_NULL_PTR, "NULL variant function should fail");
+    variant_b.fn = mock_inference_copy;
+
+    variant_b.sample_capacity = 8;  /* Too small for 16 iterations */
+    rc = cb_runner_execute_interleaved(&config, &variant_a, &variant_b,
+                                       sizeof(input), sizeof(output_a),
+                                       4, &result_a, &result_b);
+    TEST_ASSERT_EQ(rc, CB_ERR_INVALID_CONFIG, "undersized buffer should fail");
+
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Test: Results (RUNNER-F-040..052)
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -438,6 +1217,183 @@ static int test_cleanup_resets(void)
     return 0;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Pipelined Verification (SRS-003-RUNNER §4.8)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+static int test_pipelined_hash_matches_sync(void)
+{
+    cb_config_t config;
+    cb_runner_t runner;
+    cb_result_t sync_result, pipe_result;
+    static uint64_t pipe_samples[TEST_SAMPLE_CAPACITY];
+    static uint8_t input[64];
+    static uint8_t output[64];
+    static uint8_t output_a[64];
+    static uint8_t output_b[64];
+    uint32_t i;
+
+    for (i = 0; i < sizeof(input); i++) {
+        input[i] = (uint8_t)(i * 7 + 3);
+    }
+
+    cb_config_init(&config);
+    config.warmup_iterations = 5;
+    config.measure_iterations = 100;
+    config.monitor_environment = false;
+
+    /* Synchronous reference run */
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+    cb_runner_execute(&runner, mock_inference_copy, NULL,
+                      input, sizeof(input), output, sizeof(output));
+    cb_runner_get_result(&runner, &sync_result);
+    cb_runner_cleanup(&runner);
+
+    /* Pipelined run with double-buffered outputs */
+    cb_runner_init(&runner, &config, pipe_samples, TEST_SAMPLE_CAPACITY);
+    cb_result_code_t rc = cb_runner_execute_pipelined(&runner, mock_inference_copy,
+                                                      NULL, input, sizeof(input),
+                                                      output_a, output_b,
+                                                      sizeof(output_a));
+    TEST_ASSERT_EQ(rc, CB_OK, "pipelined execution succeeds");
+    TEST_ASSERT_EQ(runner.samples_collected, 100, "all samples collected");
+    cb_runner_get_result(&runner, &pipe_result);
+    cb_runner_cleanup(&runner);
+
+    /* Output hashes must be identical — hashing order is preserved */
+    TEST_ASSERT(cb_hash_equal(&sync_result.output_hash, &pipe_result.output_hash),
+                "pipelined output hash matches synchronous");
+    TEST_ASSERT(pipe_result.determinism_verified, "determinism verified");
+    TEST_ASSERT_EQ(pipe_result.latency.sample_count, 100, "stats over all samples");
+    return 0;
+}
+
+static int test_pipelined_verify_disabled(void)
+{
+    cb_config_t config;
+    cb_runner_t runner;
+    static uint8_t input[64];
+    static uint8_t output[64];
+
+    cb_config_init(&config);
+    config.warmup_iterations = 2;
+    config.measure_iterations = 10;
+    config.verify_outputs = false;
+    config.monitor_environment = false;
+
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+
+    /* With verification off the second buffer is unused and may be NULL */
+    cb_result_code_t rc = cb_runner_execute_pipelined(&runner, mock_inference_copy,
+                                                      NULL, input, sizeof(input),
+                                                      output, NULL, sizeof(output));
+    TEST_ASSERT_EQ(rc, CB_OK, "falls back to synchronous path");
+    TEST_ASSERT_EQ(runner.samples_collected, 10, "samples collected");
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+static int test_pipelined_null(void)
+{
+    cb_config_t config;
+    cb_runner_t runner;
+    static uint8_t output_a[64];
+    static uint8_t output_b[64];
+
+    cb_config_init(&config);
+    config.monitor_environment = false;
+    cb_runner_init(&runner, &config, g_sample_buffer, TEST_SAMPLE_CAPACITY);
+
+    TEST_ASSERT_EQ(cb_runner_execute_pipelined(NULL, mock_inference_copy, NULL,
+                                               NULL, 0, output_a, output_b, 64),
+                   CB_ERR_NULL_PTR, "NULL runner fails");
+    TEST_ASSERT_EQ(cb_runner_execute_pipelined(&runner, NULL, NULL,
+                                               NULL, 0, output_a, output_b, 64),
+                   CB_ERR_NULL_PTR, "NULL fn fails");
+    TEST_ASSERT_EQ(cb_runner_execute_pipelined(&runner, mock_inference_copy, NULL,
+                                               NULL, 0, NULL, output_b, 64),
+                   CB_ERR_NULL_PTR, "NULL output_a fails");
+    TEST_ASSERT_EQ(cb_runner_execute_pipelined(&runner, mock_inference_copy, NULL,
+                                               NULL, 0, output_a, NULL, 64),
+                   CB_ERR_NULL_PTR, "NULL output_b fails");
+    cb_runner_cleanup(&runner);
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Parallel Execution (SRS-003-RUNNER §4.7)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#define PARALLEL_TEST_WORKERS 2
+static uint64_t g_parallel_samples[PARALLEL_TEST_WORKERS][TEST_SAMPLE_CAPACITY];
+
+static int test_parallel_basic(void)
+{
+    cb_config_t config;
+    cb_parallel_worker_t workers[PARALLEL_TEST_WORKERS];
+    cb_result_t results[PARALLEL_TEST_WORKERS];
+    cb_result_t aggregate;
+    static uint8_t inputs[PARALLEL_TEST_WORKERS][64];
+    static uint8_t outputs[PARALLEL_TEST_WORKERS][64];
+    uint32_t i;
+    uint32_t total = 0;
+
+    cb_config_init(&config);
+    config.warmup_iterations = 5;
+    config.measure_iterations = 50;
+    config.monitor_environment = false;
+
+    for (i = 0; i < PARALLEL_TEST_WORKERS; i++) {
+        memset(&workers[i], 0, sizeof(workers[i]));
+        workers[i].core_id = i;
+        workers[i].ctx = NULL;
+        workers[i].input = inputs[i];
+        workers[i].output = outputs[i];
+        workers[i].samples = g_parallel_samples[i];
+        workers[i].sample_capacity = TEST_SAMPLE_CAPACITY;
+    }
+
+    cb_result_code_t rc = cb_runner_execute_parallel(&config, mock_inference_work,
+                                                     workers, PARALLEL_TEST_WORKERS,
+                                                     64, 64, results, &aggregate);
+    TEST_ASSERT_EQ(rc, CB_OK, "parallel execution succeeds");
+
+    for (i = 0; i < PARALLEL_TEST_WORKERS; i++) {
+        TEST_ASSERT_EQ(results[i].latency.sample_count, 50, "per-core sample count");
+        TEST_ASSERT_GT(results[i].latency.mean_ns, 0, "per-core mean positive");
+        total += results[i].latency.sample_count;
+    }
+
+    TEST_ASSERT_EQ(aggregate.latency.sample_count, total, "aggregate count is sum");
+    TEST_ASSERT_GE(aggregate.latency.max_ns, results[0].latency.max_ns,
+                   "aggregate max >= per-core max");
+    TEST_ASSERT_GE(aggregate.latency.p99_ns, results[0].latency.p99_ns,
+                   "aggregate p99 conservative");
+    TEST_ASSERT_LE(aggregate.latency.min_ns, results[0].latency.min_ns,
+                   "aggregate min <= per-core min");
+    return 0;
+}
+
+static int test_parallel_null(void)
+{
+    cb_config_t config;
+    cb_parallel_worker_t workers[1];
+    cb_result_t results[1];
+    cb_config_init(&config);
+    memset(workers, 0, sizeof(workers));
+
+    TEST_ASSERT_EQ(cb_runner_execute_parallel(NULL, mock_inference_work, workers, 1,
+                                              0, 0, results, NULL),
+                   CB_ERR_NULL_PTR, "NULL config fails");
+    TEST_ASSERT_EQ(cb_runner_execute_parallel(&config, mock_inference_work, workers, 0,
+                                              0, 0, results, NULL),
+                   CB_ERR_INVALID_CONFIG, "zero workers fails");
+    TEST_ASSERT_EQ(cb_runner_execute_parallel(&config, mock_inference_work, workers, 1,
+                                              0, 0, results, NULL),
+                   CB_ERR_INVALID_CONFIG, "NULL worker sample buffer fails");
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Main
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -468,6 +1424,44 @@ int main(void)
     printf("\n§4.2-4.3 Execute (RUNNER-F-010..023)\n");
     RUN_TEST(test_execute_sample_count);
     RUN_TEST(test_execute_positive_samples);
+    RUN_TEST(test_execute_batched_timing);
+    RUN_TEST(test_execute_timing_batch_zero);
+
+    printf("\n§4.9 Execution Isolation\n");
+    RUN_TEST(test_isolation_applied);
+    RUN_TEST(test_isolation_bad_core);
+
+    printf("\n§4.10 Interleaved A/B Execution (RUNNER-F-090..095)\n");
+    RUN_TEST(test_interleaved_ab);
+    RUN_TEST(test_interleaved_block_one);
+    RUN_TEST(test_interleaved_invalid);
+
+    printf("\n§4.11 Adaptive Stopping\n");
+    RUN_TEST(test_adaptive_stop_converges);
+    RUN_TEST(test_adaptive_stop_cap);
+    RUN_TEST(test_adaptive_stop_invalid);
+
+    printf("\n§4.3 Adaptive Warmup\n");
+    RUN_TEST(test_adaptive_warmup_converges);
+    RUN_TEST(test_adaptive_warmup_cap);
+    RUN_TEST(test_adaptive_warmup_invalid);
+
+    printf("\n§4.14 Cold-Cache Mode\n");
+    RUN_TEST(test_cold_cache_mode);
+    RUN_TEST(test_cold_cache_invalid);
+
+    printf("\n§4.15 Outlier Forensics\n");
+    RUN_TEST(test_forensics_capture);
+    RUN_TEST(test_forensics_quiet);
+    RUN_TEST(test_forensics_invalid);
+
+    printf("\n§4.16 Streaming Throughput\n");
+    RUN_TEST(test_streaming_throughput);
+    RUN_TEST(test_streaming_invalid);
+
+    printf("\n§4.12 Overhead Accounting\n");
+    RUN_TEST(test_overhead_accounting);
+    RUN_TEST(test_overhead_no_verify);
 
     printf("\n§4.5-4.6 Results (RUNNER-F-040..052)\n");
     RUN_TEST(test_result_platform);
@@ -485,6 +1479,15 @@ int main(void)
     RUN_TEST(test_cleanup_null);
     RUN_TEST(test_cleanup_resets);
 
+    printf("\n§4.8 Pipelined Verification\n");
+    RUN_TEST(test_pipelined_hash_matches_sync);
+    RUN_TEST(test_pipelined_verify_disabled);
+    RUN_TEST(test_pipelined_null);
+
+    printf("\n§4.7 Parallel Execution\n");
+    RUN_TEST(test_parallel_basic);
+    RUN_TEST(test_parallel_null);
+
     printf("\n═══════════════════════════════════════════════════════════════════\n");
     printf(" Results: %d/%d tests passed\n", g_tests_passed, g_tests_run);
     printf("═══════════════════════════════════════════════════════════════════\n");
@@ -0,0 +1,262 @@
+/**
+ * @file test_suite.c
+ * @brief Unit tests for cb_suite API
+ *
+ * Tests suite execution, per-run report overlap, the aggregate suite
+ * report, and argument validation against all SRS-009-SUITE
+ * requirements.
+ *
+ * @traceability SRS-009-SUITE §10
+ *
+ * Copyright © 2026 The Murray Family Innovation Trust. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "cb_suite.h"
+#include "cb_runner.h"
+#include "cb_report.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test Infrastructure
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+static int g_tests_run = 0;
+static int g_tests_passed = 0;
+static int g_tests_failed = 0;
+
+#define TEST_ASSERT(cond, msg) do { \
+    g_tests_run++; \
+    if (!(cond)) { \
+        printf("    FAIL: %s\n", msg); \
+        printf("          at %s:%d\n", __FILE__, __LINE__); \
+        g_tests_failed++; \
+        return -1; \
+    } else { \
+        g_tests_passed++; \
+    } \
+} while(0)
+
+#define TEST_ASSERT_EQ(a, b, msg) TEST_ASSERT((a) == (b), msg)
+#define TEST_ASSERT_GT(a, b, msg) TEST_ASSERT((a) > (b), msg)
+
+#define RUN_TEST(fn) do { \
+    printf("  %s\n", #fn); \
+    int result = fn(); \
+    if (result == 0) { \
+        printf("    PASS\n"); \
+    } \
+} while(0)
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Fixture
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#define SUITE_ENTRIES 3
+#define SUITE_SAMPLES 256
+
+static uint64_t g_samples[SUITE_ENTRIES][SUITE_SAMPLES];
+static uint8_t g_input[64];
+static uint8_t g_output[SUITE_ENTRIES][64];
+
+static cb_result_code_t mock_inference(void *ctx, const void *input,
+                                       void *output)
+{
+    volatile uint64_t sum = 0;
+    uint64_t result_val;
+    int i;
+    (void)ctx;
+    (void)input;
+    for (i = 0; i < 500; i++) {
+        sum += (uint64_t)i * (uint64_t)i;
+    }
+    result_val = sum;
+    if (output != NULL) {
+        memcpy(output, &result_val, sizeof(result_val));
+    }
+    return CB_OK;
+}
+
+/**
+ * @brief Check whether a file contains a substring
+ */
+static int file_contains(const char *path, const char *needle)
+{
+    static char buf[16384];
+    FILE *fp = fopen(path, "r");
+    size_t n;
+
+    if (!fp) return 0;
+    n = fread(buf, 1, sizeof(buf) - 1, fp);
+    fclose(fp);
+    buf[n] = '\0';
+    return strstr(buf, needle) != NULL;
+}
+
+/**
+ * @brief Populate a suite entry with shared buffers and defaults
+ */
+static void make_entry(cb_suite_entry_t *entry, uint32_t index,
+                       const char *name, const char *output_path)
+{
+    memset(entry, 0, sizeof(*entry));
+    cb_config_init(&entry->config);
+    entry->config.warmup_iterations = 5;
+    entry->config.measure_iterations = 100;
+    entry->config.batch_size = index + 1;
+    entry->config.output_path = output_path;
+    entry->name = name;
+    entry->fn = mock_inference;
+    entry->ctx = NULL;
+    entry->input = g_input;
+    entry->input_size = sizeof(g_input);
+    entry->output = g_output[index];
+    entry->output_size = sizeof(g_output[index]);
+    entry->samples = g_samples[index];
+    entry->sample_capacity = SUITE_SAMPLES;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Suite Execution (SUITE-F-001..006)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Test a full suite pass with per-run and aggregate reports
+ * @satisfies SUITE-F-001, SUITE-F-003, SUITE-F-004, SUITE-F-005
+ */
+static int test_suite_run(void)
+{
+    cb_suite_entry_t entries[SUITE_ENTRIES];
+    cb_result_t results[SUITE_ENTRIES];
+    const char *run_paths[SUITE_ENTRIES] = {
+        "/tmp/cb_test_suite_a.json",
+        "/tmp/cb_test_suite_b.json",
+        "/tmp/cb_test_suite_c.json",
+    };
+    const char *report = "/tmp/cb_test_suite.json";
+    uint32_t i;
+
+    make_entry(&entries[0], 0, "batch-1", run_paths[0]);
+    make_entry(&entries[1], 1, "batch-2", run_paths[1]);
+    make_entry(&entries[2], 2, "batch-3", run_paths[2]);
+
+    TEST_ASSERT_EQ(cb_suite_run(entries, SUITE_ENTRIES, results, report),
+                   CB_OK, "suite should run to completion");
+
+    /* Every run produced a complete result */
+    for (i = 0; i < SUITE_ENTRIES; i++) {
+        TEST_ASSERT_EQ(results[i].latency.sample_count, 100,
+                       "all samples collected");
+        TEST_ASSERT_GT(results[i].latency.mean_ns, 0, "latency measured");
+        TEST_ASSERT_EQ(results[i].batch_size, i + 1, "config echoed");
+    }
+
+    /* Per-run reports written by the overlapped writer */
+    for (i = 0; i < SUITE_ENTRIES; i++) {
+        TEST_ASSERT(file_contains(run_paths[i], "\"mean_ns\":"),
+                    "per-run report written");
+        remove(run_paths[i]);
+    }
+
+    /* Aggregate report carries names, totals and validity */
+    TEST_ASSERT(file_contains(report, "\"entries\": 3"),
+                "aggregate entry count");
+    TEST_ASSERT(file_contains(report, "\"failures\": 0"),
+                "no failures counted");
+    TEST_ASSERT(file_contains(report, "\"batch-2\""),
+                "entry names reported");
+    TEST_ASSERT(file_contains(report, "\"total_wall_ns\":"),
+                "suite wall time reported");
+    TEST_ASSERT(file_contains(report, "\"valid\": true"),
+                "validity reported");
+    remove(report);
+
+    return 0;
+}
+
+/**
+ * @brief Test that per-run and aggregate reports are optional
+ * @satisfies SUITE-F-005
+ */
+static int test_suite_no_reports(void)
+{
+    cb_suite_entry_t entries[1];
+    cb_result_t results[1];
+
+    make_entry(&entries[0], 0, NULL, NULL);
+
+    TEST_ASSERT_EQ(cb_suite_run(entries, 1, results, NULL), CB_OK,
+                   "suite without reports should run");
+    TEST_ASSERT_EQ(results[0].latency.sample_count, 100,
+                   "result still produced");
+
+    return 0;
+}
+
+/**
+ * @brief Test up-front validation and argument handling
+ * @satisfies SUITE-F-002, SUITE-F-006
+ */
+static int test_suite_invalid(void)
+{
+    cb_suite_entry_t entries[2];
+    cb_result_t results[2];
+
+    make_entry(&entries[0], 0, NULL, NULL);
+    make_entry(&entries[1], 1, NULL, NULL);
+
+    TEST_ASSERT_EQ(cb_suite_run(NULL, 1, results, NULL), CB_ERR_NULL_PTR,
+                   "NULL entries should fail");
+    TEST_ASSERT_EQ(cb_suite_run(entries, 1, NULL, NULL), CB_ERR_NULL_PTR,
+                   "NULL results should fail");
+    TEST_ASSERT_EQ(cb_suite_run(entries, 0, results, NULL),
+                   CB_ERR_INVALID_CONFIG, "empty suite should fail");
+
+    /* A bad configuration anywhere in the suite fails before any run */
+    entries[1].config.measure_iterations = 0;
+    TEST_ASSERT_EQ(cb_suite_run(entries, 2, results, NULL),
+                   CB_ERR_INVALID_CONFIG, "bad entry rejected up front");
+
+    entries[1].config.measure_iterations = 100;
+    entries[1].fn = NULL;
+    TEST_ASSERT_EQ(cb_suite_run(entries, 2, results, NULL),
+                   CB_ERR_NULL_PTR, "missing function rejected up front");
+
+    return 0;
+}
+
+/*─────────────────────────────────────────────────────────────────────────────
+ * Main
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+int main(void)
+{
+    printf("═══════════════════════════════════════════════════════════════════\n");
+    printf(" certifiable-bench Suite Driver Tests\n");
+    printf(" @traceability SRS-009-SUITE\n");
+    printf("═══════════════════════════════════════════════════════════════════\n");
+
+    printf("\n§4.2 Suite Execution (SUITE-F-001..006)\n");
+    RUN_TEST(test_suite_run);
+    RUN_TEST(test_suite_no_reports);
+    RUN_TEST(test_suite_invalid);
+
+    printf("\n═══════════════════════════════════════════════════════════════════\n");
+    printf(" Results\n");
+    printf("═══════════════════════════════════════════════════════════════════\n");
+    printf(" Tests run:    %d\n", g_tests_run);
+    printf(" Tests passed: %d\n", g_tests_passed);
+    printf(" Tests failed: %d\n", g_tests_failed);
+    printf("═══════════════════════════════════════════════════════════════════\n");
+
+    if (g_tests_failed > 0) {
+        printf("\n*** FAILURES DETECTED ***\n");
+        return 1;
+    }
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -506,6 +506,207 @@ static int test_golden_verify(void)
     return 0;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Chunked Hash Tree (SRS-004-VERIFY §4.7)
+ * Traceability: VERIFY-F-060 through VERIFY-F-064
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+#define TEST_CHUNK_DATA_SIZE 65536
+#define TEST_CHUNK_CAPACITY  128
+
+static uint8_t g_chunk_data[TEST_CHUNK_DATA_SIZE];
+static cb_hash_t g_chunk_hashes_a[TEST_CHUNK_CAPACITY];
+static cb_hash_t g_chunk_hashes_b[TEST_CHUNK_CAPACITY];
+
+static void fill_chunk_data(uint8_t *buf, uint32_t size)
+{
+    uint32_t i;
+    for (i = 0; i < size; i++) {
+        buf[i] = (uint8_t)(i * 31 + 7);
+    }
+}
+
+/**
+ * @brief Test per-chunk digests match one-shot hashes of each slice
+ * @satisfies VERIFY-F-060, VERIFY-F-061
+ */
+static int test_chunk_hashes_match_oneshot(void)
+{
+    cb_hash_t expected;
+    uint32_t num_chunks;
+    cb_result_code_t rc;
+
+    fill_chunk_data(g_chunk_data, 1000);
+
+    /* 1000 bytes in 256-byte chunks: three full plus a 232-byte tail */
+    rc = cb_hash_chunks(g_chunk_data, 1000, 256,
+                        g_chunk_hashes_a, TEST_CHUNK_CAPACITY, &num_chunks);
+    TEST_ASSERT_EQ(rc, CB_OK, "chunk hashing should succeed");
+    TEST_ASSERT_EQ(num_chunks, 4, "1000/256 rounds up to 4 chunks");
+
+    cb_compute_hash(g_chunk_data, 256, &expected);
+    TEST_ASSERT(cb_hash_equal(&g_chunk_hashes_a[0], &expected),
+                "first chunk digest matches one-shot of its bytes");
+
+    cb_compute_hash(g_chunk_data + 768, 232, &expected);
+    TEST_ASSERT(cb_hash_equal(&g_chunk_hashes_a[3], &expected),
+                "short tail chunk digest matches one-shot of its bytes");
+
+    return 0;
+}
+
+/**
+ * @brief Test parallel path produces bit-identical digests and root
+ * @satisfies VERIFY-F-062, VERIFY-F-063
+ */
+static int test_chunk_parallel_equivalence(void)
+{
+    cb_hash_t root_serial, root_parallel;
+    uint32_t num_serial, num_parallel, c;
+    cb_result_code_t rc;
+
+    fill_chunk_data(g_chunk_data, TEST_CHUNK_DATA_SIZE);
+
+    rc = cb_hash_chunks(g_chunk_data, TEST_CHUNK_DATA_SIZE, 1024,
+                        g_chunk_hashes_a, TEST_CHUNK_CAPACITY, &num_serial);
+    TEST_ASSERT_EQ(rc, CB_OK, "serial chunk hashing should succeed");
+    TEST_ASSERT_EQ(num_serial, 64, "64 KiB in 1 KiB chunks is 64 chunks");
+
+    rc = cb_hash_chunks_parallel(g_chunk_data, TEST_CHUNK_DATA_SIZE, 1024, 4,
+                                 g_chunk_hashes_b, TEST_CHUNK_CAPACITY,
+                                 &num_parallel);
+    TEST_ASSERT_EQ(rc, CB_OK, "parallel chunk hashing should succeed");
+    TEST_ASSERT_EQ(num_parallel, num_serial, "chunk counts agree");
+
+    for (c = 0; c < num_serial; c++) {
+        TEST_ASSERT(cb_hash_equal(&g_chunk_hashes_a[c], &g_chunk_hashes_b[c]),
+                    "parallel digests bit-identical to serial");
+    }
+
+    cb_hash_tree_root(g_chunk_hashes_a, num_serial, &root_serial);
+    cb_hash_tree_root(g_chunk_hashes_b, num_parallel, &root_parallel);
+    TEST_ASSERT(cb_hash_equal(&root_serial, &root_parallel),
+                "roots agree across paths");
+
+    return 0;
+}
+
+/**
+ * @brief Test first-diverging-chunk localisation
+ * @satisfies VERIFY-F-063, VERIFY-F-064
+ */
+static int test_chunk_diff_localisation(void)
+{
+    cb_hash_t root_a, root_b;
+    uint32_t num_chunks, first;
+    cb_result_code_t rc;
+
+    fill_chunk_data(g_chunk_data, TEST_CHUNK_DATA_SIZE);
+    cb_hash_chunks(g_chunk_data, TEST_CHUNK_DATA_SIZE, 1024,
+                   g_chunk_hashes_a, TEST_CHUNK_CAPACITY, &num_chunks);
+
+    /* Identical data: no divergence */
+    cb_hash_chunks(g_chunk_data, TEST_CHUNK_DATA_SIZE, 1024,
+                   g_chunk_hashes_b, TEST_CHUNK_CAPACITY, &num_chunks);
+    rc = cb_hash_chunks_diff(g_chunk_hashes_a, g_chunk_hashes_b,
+                             num_chunks, &first);
+    TEST_ASSERT_EQ(rc, CB_OK, "diff should succeed");
+    TEST_ASSERT_EQ(first, UINT32_MAX, "identical arrays report no divergence");
+
+    /* Flip one byte inside chunk 37 */
+    g_chunk_data[37 * 1024 + 100] ^= 0x01;
+    cb_hash_chunks(g_chunk_data, TEST_CHUNK_DATA_SIZE, 1024,
+                   g_chunk_hashes_b, TEST_CHUNK_CAPACITY, &num_chunks);
+
+    cb_hash_chunks_diff(g_chunk_hashes_a, g_chunk_hashes_b,
+                        num_chunks, &first);
+    TEST_ASSERT_EQ(first, 37, "divergence localised to the flipped chunk");
+
+    cb_hash_tree_root(g_chunk_hashes_a, num_chunks, &root_a);
+    cb_hash_tree_root(g_chunk_hashes_b, num_chunks, &root_b);
+    TEST_ASSERT(!cb_hash_equal(&root_a, &root_b),
+                "diverging chunk changes the root");
+
+    return 0;
+}
+
+/**
+ * @brief Test golden roundtrip with tree fields, and legacy goldens
+ * @satisfies VERIFY-F-063
+ */
+static int test_chunk_tree_golden_roundtrip(void)
+{
+    cb_golden_ref_t original, loaded;
+    uint32_t num_chunks;
+    const char *path = "/tmp/cb_test_golden_tree.json";
+
+    memset(&original, 0, sizeof(original));
+    memset(&loaded, 0, sizeof(loaded));
+
+    fill_chunk_data(g_chunk_data, 4096);
+    cb_compute_hash(g_chunk_data, 4096, &original.output_hash);
+    cb_hash_chunks(g_chunk_data, 4096, 1024,
+                   g_chunk_hashes_a, TEST_CHUNK_CAPACITY, &num_chunks);
+    cb_hash_tree_root(g_chunk_hashes_a, num_chunks, &original.tree_root);
+    original.sample_count = 4;
+    original.output_size = 1024;
+    original.chunk_size = 1024;
+    original.num_chunks = num_chunks;
+    strncpy(original.platform, "x86_64", sizeof(original.platform) - 1);
+
+    TEST_ASSERT_EQ(cb_golden_save(path, &original), CB_OK,
+                   "golden_save with tree should succeed");
+    TEST_ASSERT_EQ(cb_golden_load(path, &loaded), CB_OK,
+                   "golden_load with tree should succeed");
+    TEST_ASSERT(cb_hash_equal(&original.tree_root, &loaded.tree_root),
+                "tree root survives roundtrip");
+    TEST_ASSERT_EQ(loaded.chunk_size, 1024, "chunk_size survives roundtrip");
+    TEST_ASSERT_EQ(loaded.num_chunks, 4, "num_chunks survives roundtrip");
+    remove(path);
+
+    /* A golden saved without a tree loads with the fields zeroed */
+    original.chunk_size = 0;
+    TEST_ASSERT_EQ(cb_golden_save(path, &original), CB_OK,
+                   "legacy golden_save should succeed");
+    TEST_ASSERT_EQ(cb_golden_load(path, &loaded), CB_OK,
+                   "legacy golden_load should succeed");
+    TEST_ASSERT_EQ(loaded.chunk_size, 0, "legacy golden has no chunk_size");
+    TEST_ASSERT_EQ(loaded.num_chunks, 0, "legacy golden has no num_chunks");
+    remove(path);
+
+    return 0;
+}
+
+/**
+ * @brief Test chunked hashing argument validation
+ * @satisfies VERIFY-F-060
+ */
+static int test_chunk_invalid(void)
+{
+    cb_hash_t root;
+    uint32_t num_chunks;
+
+    TEST_ASSERT_EQ(cb_hash_chunks(NULL, 1024, 256, g_chunk_hashes_a,
+                                  TEST_CHUNK_CAPACITY, &num_chunks),
+                   CB_ERR_NULL_PTR, "NULL data rejected");
+    TEST_ASSERT_EQ(cb_hash_chunks(g_chunk_data, 0, 256, g_chunk_hashes_a,
+                                  TEST_CHUNK_CAPACITY, &num_chunks),
+                   CB_ERR_INVALID_CONFIG, "zero size rejected");
+    TEST_ASSERT_EQ(cb_hash_chunks(g_chunk_data, 1024, 0, g_chunk_hashes_a,
+                                  TEST_CHUNK_CAPACITY, &num_chunks),
+                   CB_ERR_INVALID_CONFIG, "zero chunk_size rejected");
+    TEST_ASSERT_EQ(cb_hash_chunks(g_chunk_data, TEST_CHUNK_DATA_SIZE, 16,
+                                  g_chunk_hashes_a, TEST_CHUNK_CAPACITY,
+                                  &num_chunks),
+                   CB_ERR_OUT_OF_MEMORY, "undersized digest array rejected");
+    TEST_ASSERT_EQ(cb_hash_tree_root(g_chunk_hashes_a, 0, &root),
+                   CB_ERR_INVALID_CONFIG, "zero-chunk root rejected");
+    TEST_ASSERT_EQ(cb_hash_chunks_diff(NULL, g_chunk_hashes_b, 1, &num_chunks),
+                   CB_ERR_NULL_PTR, "NULL diff operand rejected");
+
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Test: Result Binding (SRS-004-VERIFY §4.5)
  * Traceability: VERIFY-F-040 through VERIFY-F-047
@@ -610,6 +811,61 @@ static int test_determinism(void)
     return 0;
 }
 
+/*─────────────────────────────────────────────────────────────────────────────
+ * Test: Hardware Acceleration (SRS-004-VERIFY §5.2)
+ *─────────────────────────────────────────────────────────────────────────────*/
+
+/**
+ * @brief Test hardware and scalar paths produce identical digests
+ *
+ * Hashes the same inputs with acceleration enabled and forced off;
+ * digests must match bit-for-bit regardless of which path ran.
+ */
+static int test_accel_scalar_equivalence(void)
+{
+    uint8_t data[1024];
+    cb_hash_t hw_hash, sc_hash;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    /* Sweep sizes across block boundaries: 0, 1, 63, 64, 65, ... */
+    for (i = 0; i <= sizeof(data); i += (i < 70) ? 1 : 97) {
+        cb_verify_set_accel(true);
+        TEST_ASSERT_EQ(cb_compute_hash(data, i, &hw_hash), CB_OK,
+                       "hash with acceleration allowed");
+
+        cb_verify_set_accel(false);
+        TEST_ASSERT_EQ(cb_compute_hash(data, i, &sc_hash), CB_OK,
+                       "hash with scalar forced");
+
+        TEST_ASSERT(cb_hash_equal(&hw_hash, &sc_hash),
+                    "accelerated and scalar digests match");
+    }
+
+    cb_verify_set_accel(true);
+    return 0;
+}
+
+/**
+ * @brief Test acceleration control round-trips
+ */
+static int test_accel_control(void)
+{
+    bool detected = cb_verify_accel_available();
+
+    cb_verify_set_accel(false);
+    TEST_ASSERT(!cb_verify_accel_available(), "scalar forced reports no accel");
+
+    cb_verify_set_accel(true);
+    TEST_ASSERT_EQ(cb_verify_accel_available(), detected,
+                   "re-enable restores detected capability");
+
+    return 0;
+}
+
 /*─────────────────────────────────────────────────────────────────────────────
  * Main
  *─────────────────────────────────────────────────────────────────────────────*/
@@ -649,10 +905,21 @@ int main(void)
     RUN_TEST(test_golden_load_missing);
     RUN_TEST(test_golden_verify);
 
+    printf("\n§4.7 Chunked Hash Tree (VERIFY-F-060..064)\n");
+    RUN_TEST(test_chunk_hashes_match_oneshot);
+    RUN_TEST(test_chunk_parallel_equivalence);
+    RUN_TEST(test_chunk_diff_localisation);
+    RUN_TEST(test_chunk_tree_golden_roundtrip);
+    RUN_TEST(test_chunk_invalid);
+
     printf("\n§4.5 Result Binding (VERIFY-F-040..047)\n");
     RUN_TEST(test_result_binding);
     RUN_TEST(test_result_binding_null);
 
+    printf("\n§5.2 Hardware Acceleration\n");
+    RUN_TEST(test_accel_scalar_equivalence);
+    RUN_TEST(test_accel_control);
+
     printf("\n§5.1 Determinism (VERIFY-NF-001)\n");
     RUN_TEST(test_determinism);
 
@@ -0,0 +1,233 @@
+/**
+ * @file cb_resultdb_cli.c
+ * @brief Command-line front end for the result database
+ *
+ * Thin shell over cb_resultdb so the Python regression tooling can
+ * query a 400k-result history in milliseconds instead of walking
+ * directories of JSON files. Output is one line per entry in a fixed
+ * column order, trivially parseable.
+ *
+ *   cb-resultdb add    <base> <result.json>
+ *   cb-resultdb count  <base>
+ *   cb-resultdb latest <base> <platform> <cpu_model> <hash_hex> <N>
+ *   cb-resultdb query  <base> <platform> <cpu_model> <hash_hex> \
+ *                      <ts_min> <ts_max>
+ *
+ * <base> names the database; the files are <base>.dat and <base>.idx.
+ *
+ * @traceability SRS-008-RESULTDB §4.4
+ *
+ * Copyright © 2026 The Murray Family Innovation Trust. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "cb_report.h"
+#include "cb_resultdb.h"
+#include "cb_verify.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CLI_MAX_ENTRIES 4096
+
+static cb_resultdb_entry_t g_entries[CLI_MAX_ENTRIES];
+static cb_result_t g_result;
+
+/**
+ * @brief Build the data/index paths from the database base name
+ */
+static int make_paths(const char *base, char *data_path, char *index_path,
+                      size_t capacity)
+{
+    if (strlen(base) + 5 > capacity) {
+        return -1;
+    }
+    snprintf(data_path, capacity, "%s.dat", base);
+    snprintf(index_path, capacity, "%s.idx", base);
+    return 0;
+}
+
+/**
+ * @brief Print one entry with the stats of its stored record
+ */
+static int print_entry(const cb_resultdb_t *db,
+                       const cb_resultdb_entry_t *entry)
+{
+    if (cb_resultdb_load(db, entry, &g_result) != CB_OK) {
+        fprintf(stderr, "error: corrupt record at offset %" PRIu64 "\n",
+                entry->offset);
+        return -1;
+    }
+    printf("%" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64
+           " %s %s\n",
+           entry->timestamp_unix, entry->offset,
+           g_result.latency.mean_ns, g_result.latency.p99_ns,
+           g_result.throughput.inferences_per_sec,
+           g_result.platform, g_result.cpu_model);
+    return 0;
+}
+
+static int cmd_add(const char *base, const char *json_path)
+{
+    char data_path[512], index_path[512];
+    cb_resultdb_t db;
+    cb_result_code_t rc;
+
+    if (make_paths(base, data_path, index_path, sizeof(data_path)) != 0) {
+        fprintf(stderr, "error: database path too long\n");
+        return 1;
+    }
+
+    rc = cb_load_json(json_path, &g_result);
+    if (rc != CB_OK) {
+        fprintf(stderr, "error: cannot load %s (code %d)\n", json_path, rc);
+        return 1;
+    }
+
+    rc = cb_resultdb_open(&db, data_path, index_path);
+    if (rc != CB_OK) {
+        fprintf(stderr, "error: cannot open database %s (code %d)\n",
+                base, rc);
+        return 1;
+    }
+
+    rc = cb_resultdb_append(&db, &g_result);
+    cb_resultdb_close(&db);
+    if (rc != CB_OK) {
+        fprintf(stderr, "error: append failed (code %d)\n", rc);
+        return 1;
+    }
+    return 0;
+}
+
+static int cmd_count(const char *base)
+{
+    char data_path[512], index_path[512];
+    cb_resultdb_t db;
+
+    if (make_paths(base, data_path, index_path, sizeof(data_path)) != 0) {
+        fprintf(stderr, "error: database path too long\n");
+        return 1;
+    }
+    if (cb_resultdb_open(&db, data_path, index_path) != CB_OK) {
+        fprintf(stderr, "error: cannot open database %s\n", base);
+        return 1;
+    }
+    printf("%" PRIu64 "\n", cb_resultdb_count(&db));
+    cb_resultdb_close(&db);
+    return 0;
+}
+
+/**
+ * @brief Shared setup for query-style commands: open and derive key
+ */
+static int open_with_key(const char *base, const char *platform,
+                         const char *cpu_model, const char *hash_hex,
+                         cb_resultdb_t *db, uint64_t *key)
+{
+    char data_path[512], index_path[512];
+    cb_hash_t model_hash;
+
+    if (make_paths(base, data_path, index_path, sizeof(data_path)) != 0) {
+        fprintf(stderr, "error: database path too long\n");
+        return -1;
+    }
+    if (cb_hash_from_hex(hash_hex, &model_hash) != CB_OK) {
+        fprintf(stderr, "error: invalid model hash\n");
+        return -1;
+    }
+    if (cb_resultdb_open(db, data_path, index_path) != CB_OK) {
+        fprintf(stderr, "error: cannot open database %s\n", base);
+        return -1;
+    }
+    cb_resultdb_make_key(platform, cpu_model, &model_hash, key);
+    return 0;
+}
+
+static int cmd_latest(const char *base, const char *platform,
+                      const char *cpu_model, const char *hash_hex,
+                      uint32_t n)
+{
+    cb_resultdb_t db;
+    uint64_t key;
+    uint32_t count, i;
+    int status = 0;
+
+    if (n > CLI_MAX_ENTRIES) {
+        n = CLI_MAX_ENTRIES;
+    }
+    if (open_with_key(base, platform, cpu_model, hash_hex, &db, &key) != 0) {
+        return 1;
+    }
+
+    cb_resultdb_latest(&db, key, n, g_entries, &count);
+    for (i = 0; i < count; i++) {
+        if (print_entry(&db, &g_entries[i]) != 0) {
+            status = 1;
+        }
+    }
+    cb_resultdb_close(&db);
+    return status;
+}
+
+static int cmd_query(const char *base, const char *platform,
+                     const char *cpu_model, const char *hash_hex,
+                     uint64_t ts_min, uint64_t ts_max)
+{
+    cb_resultdb_t db;
+    uint64_t key;
+    uint32_t count, i;
+    cb_result_code_t rc;
+    int status = 0;
+
+    if (open_with_key(base, platform, cpu_model, hash_hex, &db, &key) != 0) {
+        return 1;
+    }
+
+    rc = cb_resultdb_query(&db, key, ts_min, ts_max,
+                           g_entries, CLI_MAX_ENTRIES, &count);
+    if (rc == CB_ERR_OUT_OF_MEMORY) {
+        fprintf(stderr, "warning: result truncated to %u entries\n", count);
+    }
+    for (i = 0; i < count; i++) {
+        if (print_entry(&db, &g_entries[i]) != 0) {
+            status = 1;
+        }
+    }
+    cb_resultdb_close(&db);
+    return status;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: cb-resultdb add    <base> <result.json>\n"
+            "       cb-resultdb count  <base>\n"
+            "       cb-resultdb latest <base> <platform> <cpu_model>"
+            " <hash_hex> <N>\n"
+            "       cb-resultdb query  <base> <platform> <cpu_model>"
+            " <hash_hex> <ts_min> <ts_max>\n");
+}
+
+int main(int argc, char **argv)
+{
+    if (argc >= 4 && strcmp(argv[1], "add") == 0) {
+        return cmd_add(argv[2], argv[3]);
+    }
+    if (argc >= 3 && strcmp(argv[1], "count") == 0) {
+        return cmd_count(argv[2]);
+    }
+    if (argc >= 7 && strcmp(argv[1], "latest") == 0) {
+        return cmd_latest(argv[2], argv[3], argv[4], argv[5],
+                          (uint32_t)strtoul(argv[6], NULL, 10));
+    }
+    if (argc >= 8 && strcmp(argv[1], "query") == 0) {
+        return cmd_query(argv[2], argv[3], argv[4], argv[5],
+                         strtoull(argv[6], NULL, 10),
+                         strtoull(argv[7], NULL, 10));
+    }
+    usage();
+    return 2;
+}